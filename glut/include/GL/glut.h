@@ -320,9 +320,31 @@ extern void exit(int);
  GLUT_XLIB_IMPLEMENTATION=16 mjk's early GLUT 3.8 
 
  GLUT_XLIB_IMPLEMENTATION=17 mjk's GLUT 3.8 with glutStrokeWidthf and glutStrokeLengthf
+
+ GLUT_XLIB_IMPLEMENTATION=18 mjk's GLUT 3.8 with monotonic nanosecond clock (glutGetNanoseconds)
+
+ GLUT_XLIB_IMPLEMENTATION=19 mjk's GLUT 3.8 with cancellable timers (glutScheduleTimer)
+
+ GLUT_XLIB_IMPLEMENTATION=20 mjk's GLUT 3.8 with file descriptor watches and glutWakeup
+
+ GLUT_XLIB_IMPLEMENTATION=21 mjk's GLUT 3.8 with nanosecond timer deadlines (glutScheduleTimerAt)
+
+ GLUT_XLIB_IMPLEMENTATION=22 mjk's GLUT 3.8 with rate limited idle (glutIdlePolicy)
+
+ GLUT_XLIB_IMPLEMENTATION=23 mjk's GLUT 3.8 with motion and reshape event coalescing
+
+ GLUT_XLIB_IMPLEMENTATION=24 mjk's GLUT 3.8 with glutRunOnMainLoop for other threads
+
+ GLUT_XLIB_IMPLEMENTATION=25 mjk's GLUT 3.8 with context switch counts (GLUT_CONTEXT_SWITCHES)
+
+ GLUT_XLIB_IMPLEMENTATION=26 mjk's GLUT 3.8 with the null window system (glutInit -null, glutInject*)
+
+ GLUT_XLIB_IMPLEMENTATION=27 mjk's GLUT 3.8 with EGL pbuffer rendering for it (glutInit -egl)
+
+ GLUT_XLIB_IMPLEMENTATION=28 mjk's GLUT 3.8 with virtual and program clocks (glutInit -virtualclock, glutClockFunc)
 **/
 #ifndef GLUT_XLIB_IMPLEMENTATION  /* Allow this to be overriden. */
-#define GLUT_XLIB_IMPLEMENTATION        17
+#define GLUT_XLIB_IMPLEMENTATION        28
 #endif
 
 /* Display mode bit masks. */
@@ -491,6 +513,25 @@ GLUTAPI void *glutBitmapHelvetica18;
 #if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 13)
 #define GLUT_WINDOW_FORMAT_ID           ((GLenum) 123)
 #endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 18)
+#define GLUT_CLOCK_SOURCE               ((GLenum) 701)
+
+/* GLUT_CLOCK_SOURCE values. */
+#define GLUT_CLOCK_MONOTONIC            0
+#define GLUT_CLOCK_TSC                  1
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 28)
+#define GLUT_CLOCK_VIRTUAL              2
+#define GLUT_CLOCK_PROGRAM              3
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 23)
+#define GLUT_COALESCED_MOTION           ((GLenum) 702)
+#define GLUT_COALESCED_RESHAPE          ((GLenum) 703)
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 25)
+#define GLUT_CONTEXT_SWITCHES           ((GLenum) 704)
+#define GLUT_CONTEXT_SWITCHES_AVOIDED   ((GLenum) 705)
+#endif
 
 #if (GLUT_API_VERSION >= 2)
 /* glutDeviceGet parameters. */
@@ -674,6 +715,35 @@ GLUTAPI void GLUTAPIENTRY glutEntryFunc(void (GLUTCALLBACK *func)(int state));
 GLUTAPI void GLUTAPIENTRY glutVisibilityFunc(void (GLUTCALLBACK *func)(int state));
 GLUTAPI void GLUTAPIENTRY glutIdleFunc(void (GLUTCALLBACK *func)(void));
 GLUTAPI void GLUTAPIENTRY glutTimerFunc(unsigned int millis, void (GLUTCALLBACK *func)(int value), int value);
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 19)
+/* glutTimerFunc returning a handle, nonzero, for the timer.  Cancel
+   and reschedule return 1 if the timer was still pending (or, for
+   reschedule, is the one whose callback is running), else 0. */
+GLUTAPI int GLUTAPIENTRY glutScheduleTimer(unsigned int millis, void (GLUTCALLBACK *func)(int value), int value);
+GLUTAPI int GLUTAPIENTRY glutCancelTimer(int timer);
+GLUTAPI int GLUTAPIENTRY glutRescheduleTimer(int timer, unsigned int millis);
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 20)
+/* glutWatchFd has the main loop call func when fd is readable or
+   writable, as events asks; a NULL func or zero events stops
+   watching (the callback may do this itself).  Stop watching before
+   closing fd.  Returns 0 if fd cannot be watched (always so on
+   Win32).  glutWakeup, safe from any thread or signal handler, has
+   the main loop call the glutWakeupFunc callback, which must be
+   set first; wakeups before it runs are coalesced. */
+#define GLUT_WATCH_READ                 1
+#define GLUT_WATCH_WRITE                2
+GLUTAPI int GLUTAPIENTRY glutWatchFd(int fd, int events, void (GLUTCALLBACK *func)(int fd, int events));
+GLUTAPI void GLUTAPIENTRY glutWakeupFunc(void (GLUTCALLBACK *func)(void));
+GLUTAPI void GLUTAPIENTRY glutWakeup(void);
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 24)
+/* Safe from any thread after glutInit: the main loop wakes and calls
+   func(data), or posts a redisplay for window win, in the order
+   posted.  Every other GLUT routine remains main thread only. */
+GLUTAPI void GLUTAPIENTRY glutRunOnMainLoop(void (GLUTCALLBACK *func)(void *data), void *data);
+GLUTAPI void GLUTAPIENTRY glutPostWindowRedisplayFromThread(int win);
+#endif
 GLUTAPI void GLUTAPIENTRY glutMenuStateFunc(void (GLUTCALLBACK *func)(int state));
 #if (GLUT_API_VERSION >= 2)
 GLUTAPI void GLUTAPIENTRY glutSpecialFunc(void (GLUTCALLBACK *func)(int key, int x, int y));
@@ -729,6 +799,60 @@ GLUTAPI float GLUTAPIENTRY glutStrokeWidthf(void *font, int character);
 GLUTAPI float GLUTAPIENTRY glutStrokeLengthf(void *font, const unsigned char *string);
 #endif
 
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 18)
+/* GLUT clock sub-API. */
+#if defined(_MSC_VER) && _MSC_VER < 1300
+typedef unsigned __int64 GLUTnanoseconds;
+#else
+typedef unsigned long long GLUTnanoseconds;
+#endif
+/* Monotonic nanoseconds since glutInit; unaffected by wall clock steps. */
+GLUTAPI GLUTnanoseconds GLUTAPIENTRY glutGetNanoseconds(void);
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 21)
+/* Timers with glutGetNanoseconds deadlines.  A timer may fire up to
+   slack after its deadline so its wakeup can serve other timers too.
+   Pacing each frame from the previous deadline, not from when the
+   callback ran, keeps a frame rate from drifting.
+   glutGetTimerLateness returns how many timers have fired, with the
+   mean and worst time from deadline to firing (either pointer may be
+   NULL); nonzero reset starts the counts over. */
+GLUTAPI int GLUTAPIENTRY glutScheduleTimerAt(GLUTnanoseconds deadline, GLUTnanoseconds slack, void (GLUTCALLBACK *func)(int value), int value);
+GLUTAPI int GLUTAPIENTRY glutRescheduleTimerAt(int timer, GLUTnanoseconds deadline);
+GLUTAPI int GLUTAPIENTRY glutGetTimerLateness(GLUTnanoseconds *mean, GLUTnanoseconds *worst, int reset);
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 22)
+/* glutIdlePolicy policies.  Continuous, the default, calls the idle
+   func on every pass of the main loop, so it never sleeps.  Interval
+   calls it at most every interval nanoseconds, refresh at most once
+   per display refresh, and after events only once after each wakeup
+   for events, timers, or glutWakeup; the loop sleeps in between. */
+#define GLUT_IDLE_CONTINUOUS            0
+#define GLUT_IDLE_INTERVAL              1
+#define GLUT_IDLE_REFRESH               2
+#define GLUT_IDLE_AFTER_EVENTS          3
+GLUTAPI void GLUTAPIENTRY glutIdlePolicy(int policy, GLUTnanoseconds interval);
+/* Returns how many times glutMainLoop has woken from sleep, with the
+   process CPU time and the elapsed time over the same span (either
+   pointer may be NULL), counting from glutMainLoop or the last
+   reset. */
+GLUTAPI int GLUTAPIENTRY glutGetMainLoopLoad(GLUTnanoseconds *cpu, GLUTnanoseconds *elapsed, int reset);
+#endif
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 28)
+/* Replacements for real time, read by timers, GLUT_ELAPSED_TIME,
+   and glutGetNanoseconds alike.  After glutInit with -virtualclock,
+   time only passes when the main loop would sleep until a timer or
+   idle deadline, and then jumps to it, so hours of paced callbacks
+   run in moments and identically every run.  When work is always
+   ready (a continuous idle func or constant redisplays), each pass
+   of the loop with no events pending jumps instead.
+   glutAdvanceClock moves it on by hand.  glutClockFunc makes func, returning nanoseconds,
+   the clock, carrying on from the current time; NULL goes back to
+   glutInit's clock. */
+GLUTAPI void GLUTAPIENTRY glutClockFunc(GLUTnanoseconds (GLUTCALLBACK *func)(void));
+GLUTAPI void GLUTAPIENTRY glutAdvanceClock(GLUTnanoseconds delta);
+#endif
+
 /* GLUT pre-built models sub-API */
 GLUTAPI void GLUTAPIENTRY glutWireSphere(GLdouble radius, GLint slices, GLint stacks);
 GLUTAPI void GLUTAPIENTRY glutSolidSphere(GLdouble radius, GLint slices, GLint stacks);
@@ -776,6 +900,17 @@ GLUTAPI void GLUTAPIENTRY glutReportErrors(void);
 
 GLUTAPI void GLUTAPIENTRY glutIgnoreKeyRepeat(int ignore);
 GLUTAPI void GLUTAPIENTRY glutSetKeyRepeat(int repeatMode);
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 23)
+/* glutCoalesceEvents mask bits.  Queued back to back motion events in
+   a window (with the same mouse buttons down) become one motion or
+   passive motion callback with the latest position, and back to back
+   configure events one reshape with the latest size.
+   glutGet(GLUT_COALESCED_MOTION) and glutGet(GLUT_COALESCED_RESHAPE)
+   count the events dropped. */
+#define GLUT_COALESCE_MOTION            1
+#define GLUT_COALESCE_RESHAPE           2
+GLUTAPI void GLUTAPIENTRY glutCoalesceEvents(int mask);
+#endif
 GLUTAPI void GLUTAPIENTRY glutForceJoystickFunc(void);
 
 /* GLUT game mode sub-API. */
@@ -794,6 +929,26 @@ GLUTAPI void GLUTAPIENTRY glutLeaveGameMode(void);
 GLUTAPI int GLUTAPIENTRY glutGameModeGet(GLenum mode);
 #endif
 
+#if (GLUT_API_VERSION >= 4 || GLUT_XLIB_IMPLEMENTATION >= 26)
+/* GLUT event injection sub-API.  After glutInit with -null, windows
+   are bookkeeping only (no OpenGL contexts, so callbacks must not
+   render; -egl is -null with each window rendering to an EGL pbuffer
+   of its size) and these queue events for the main loop to dispatch,
+   in order, like those from a window system.  Windows are named by
+   glutCreateWindow number and positions are window relative.
+   glutInjectModifiers sets the GLUT_ACTIVE_* mask that later events
+   carry.  Without -null or -egl, and always on Win32, they do
+   nothing. */
+GLUTAPI void GLUTAPIENTRY glutInjectModifiers(int modifiers);
+GLUTAPI void GLUTAPIENTRY glutInjectMouse(int win, int button, int state, int x, int y);
+GLUTAPI void GLUTAPIENTRY glutInjectMotion(int win, int x, int y);
+GLUTAPI void GLUTAPIENTRY glutInjectEntry(int win, int state, int x, int y);
+GLUTAPI void GLUTAPIENTRY glutInjectKeyboard(int win, unsigned char key, int state, int x, int y);
+GLUTAPI void GLUTAPIENTRY glutInjectSpecial(int win, int key, int state, int x, int y);
+GLUTAPI void GLUTAPIENTRY glutInjectReshape(int win, int width, int height);
+GLUTAPI void GLUTAPIENTRY glutInjectWindowStatus(int win, int state);
+#endif
+
 #ifdef __cplusplus
 }
 
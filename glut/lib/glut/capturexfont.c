@@ -21,42 +21,52 @@
 #define MAX_GLYPHS_PER_GRAB 512  /* This is big enough for 2^9
                                     glyph character sets */
 
+/* Glyph captured from the X font, held until the whole font has
+   been grabbed so the bitmaps can be emitted in character order as
+   one contiguous array. */
+typedef struct {
+  int defined;
+  int width, height;
+  int xorig, yorig;
+  int advance;
+  int size;
+  GLubyte *bitmap;
+} CapturedChar;
+
 static void
-outputChar(int num, int width, int height,
-  int xoff, int yoff, int advance, int data)
+checkRange(int num, const char *what, int value, int min, int max)
 {
-  if (width == 0 || height == 0) {
-    printf("#ifdef _WIN32\n");
-    printf("/* XXX Work around Microsoft OpenGL 1.1 bug where glBitmap with\n");
-    printf("   a height or width of zero does not advance the raster position\n");
-    printf("   as specified by OpenGL. (Cosmo OpenGL does not have this bug.) */\n");
-    printf("static const GLubyte ch%ddata[] = { 0x0 };\n", num);
-    printf("static const BitmapCharRec ch%d = {", num);
-    printf("%d,", 0);
-    printf("%d,", 0);
-    printf("%d,", xoff);
-    printf("%d,", yoff);
-    printf("%d,", advance);
-    printf("ch%ddata", num);
-    printf("};\n");
-    printf("#else\n");
+  if (value < min || value > max) {
+    fprintf(stderr,
+      "capturexfont: char 0x%x %s of %d does not fit in [%d,%d]\n",
+      num, what, value, min, max);
+    exit(1);
   }
-  printf("static const BitmapCharRec ch%d = {", num);
-  printf("%d,", width);
-  printf("%d,", height);
-  printf("%d,", xoff);
-  printf("%d,", yoff);
-  printf("%d,", advance);
+}
+
+static void
+recordChar(CapturedChar * cc, int num, int width, int height,
+  int xoff, int yoff, int advance, GLubyte * data, int size)
+{
+  /* BitmapCharRec stores its metrics in bytes. */
+  checkRange(num, "width", width, 0, 255);
+  checkRange(num, "height", height, 0, 255);
+  checkRange(num, "x origin", xoff, -128, 127);
+  checkRange(num, "y origin", yoff, -128, 127);
+  checkRange(num, "advance", advance, 0, 255);
+  cc->defined = 1;
+  cc->width = width;
+  cc->height = height;
+  cc->xorig = xoff;
+  cc->yorig = yoff;
+  cc->advance = advance;
+  cc->size = size;
   if (data) {
-    printf("ch%ddata", num);
+    cc->bitmap = malloc(size);
+    memcpy(cc->bitmap, data, size);
   } else {
-    printf("0");
+    cc->bitmap = NULL;
   }
-  printf("};\n");
-  if (width == 0 || height == 0) {
-    printf("#endif\n");
-  }
-  printf("\n");
 }
 
 /* Can't just use isprint because it only works for the range
@@ -88,6 +98,8 @@ captureXFont(Display * dpy, Font font, char *xfont, char *name)
   int numToGrab;
   int rows, pages, byte1, byte2, index;
   int nullBitmap;
+  CapturedChar *captured, *cc;
+  int offset;
 
   drawable = RootWindow(dpy, DefaultScreen(dpy));
 
@@ -136,8 +148,7 @@ captureXFont(Display * dpy, Font font, char *xfont, char *name)
     charHeight = charinfo->ascent + charinfo->descent;
     spanLength = (charWidth + 7) / 8;
   }
-  printf("\n/* GENERATED FILE -- DO NOT MODIFY */\n\n");
-  printf("#include \"glutbitmap.h\"\n\n");
+  captured = calloc(count, sizeof(CapturedChar));
   for (i = first; count; i++, count--) {
     int undefined;
     if (rows == 1) {
@@ -170,10 +181,9 @@ captureXFont(Display * dpy, Font font, char *xfont, char *name)
       charHeight = charinfo->ascent + charinfo->descent;
       if (charWidth == 0 || charHeight == 0) {
         if (charinfo->width != 0) {
-          /* Still must move raster pos even if empty character 
-
-           */
-          outputChar(i, 0, 0, 0, 0, charinfo->width, 0);
+          /* Still must move raster pos even if empty character */
+          recordChar(&captured[i - first], i,
+            0, 0, 0, 0, charinfo->width, NULL, 0);
         }
         goto PossiblyDoGrab;
       }
@@ -224,13 +234,6 @@ captureXFont(Display * dpy, Font font, char *xfont, char *name)
             }
           }
         }
-        if (PRINTABLE(grabList[j])) {
-          printf("/* char: 0x%x '%c' */\n\n",
-            grabList[j], grabList[j]);
-        } else {
-          printf("/* char: 0x%x */\n\n", grabList[j]);
-        }
-
         /* Determine if the bitmap is null. */
         nullBitmap = 1;
         len = (charinfo->ascent + charinfo->descent) *
@@ -245,25 +248,14 @@ captureXFont(Display * dpy, Font font, char *xfont, char *name)
         }
 
         if (!nullBitmap) {
-          printf("static const GLubyte ch%ddata[] = {\n", grabList[j]);
-          len = (charinfo->ascent + charinfo->descent) *
-            ((charinfo->rbearing - charinfo->lbearing + 7) / 8);
-          cnt = 0;
-          while (cnt < len) {
-            for (k = 0; k < 16 && cnt < len; k++, cnt++) {
-              printf("0x%x,", bitmapData[cnt]);
-            }
-            printf("\n");
-          }
-          printf("};\n\n");
-        } else {
-          charWidth = 0;
-          charHeight = 0;
+          recordChar(&captured[grabList[j] - first], grabList[j],
+            charWidth, charHeight,
+            -charinfo->lbearing, charinfo->descent,
+            charinfo->width, bitmapData, len);
+        } else if (charinfo->width != 0) {
+          recordChar(&captured[grabList[j] - first], grabList[j],
+            0, 0, 0, 0, charinfo->width, NULL, 0);
         }
-
-        outputChar(grabList[j], charWidth, charHeight,
-          -charinfo->lbearing, charinfo->descent,
-          charinfo->width, !nullBitmap);
       }
       XDestroyImage(image);
       numToGrab = 0;
@@ -281,48 +273,64 @@ captureXFont(Display * dpy, Font font, char *xfont, char *name)
      bitmapData, but we could. */
   free(bitmapData);
 
-  printf("static const BitmapCharRec * const chars[] = {\n");
+  printf("\n/* GENERATED FILE -- DO NOT MODIFY */\n\n");
+  printf("/* X font: %s */\n\n", xfont);
+  /* glut.h declares the font names as void*, so hide that
+     declaration while defining the real BitmapFontRec. */
+  printf("#define %s XXX\n", name);
+  printf("#include \"glutbitmap.h\"\n");
+  printf("#undef %s\n\n", name);
+
+  /* All glyph bitmaps go into one contiguous array so the font
+     needs no per-glyph pointers (and so no per-glyph relocations)
+     and drawing a string touches adjacent cache lines. */
+  printf("static const GLubyte bitmaps[] = {\n");
   for (i = first; i <= last; i++) {
-    int undefined;
-    byte2 = i & 0xff;
-    byte1 = i >> 8;
-    undefined = (fontinfo->min_char_or_byte2 > byte2 ||
-      fontinfo->max_char_or_byte2 < byte2 ||
-      fontinfo->min_byte1 > byte1 ||
-      fontinfo->max_byte1 < byte1);
-    if (undefined) {
-      printf("0,\n");
+    cc = &captured[i - first];
+    if (!cc->bitmap) {
+      continue;
+    }
+    if (PRINTABLE(i)) {
+      printf("/* char: 0x%x '%c' */\n", i, i);
     } else {
-      if (fontinfo->per_char != NULL) {
-        if (rows == 1) {
-          index = i - fontinfo->min_char_or_byte2;
-        } else {
-          byte2 = i & 0xff;
-          byte1 = i >> 8;
-          index =
-            (byte1 - fontinfo->min_byte1) * pages +
-            (byte2 - fontinfo->min_char_or_byte2);
-        }
-        charinfo = &(fontinfo->per_char[index]);
-        charWidth = charinfo->rbearing - charinfo->lbearing;
-        charHeight = charinfo->ascent + charinfo->descent;
-        if (charWidth == 0 || charHeight == 0) {
-          if (charinfo->width == 0) {
-            printf("0,\n");
-            continue;
-          }
-        }
+      printf("/* char: 0x%x */\n", i);
+    }
+    cnt = 0;
+    while (cnt < cc->size) {
+      for (k = 0; k < 16 && cnt < cc->size; k++, cnt++) {
+        printf("0x%x,", cc->bitmap[cnt]);
       }
-      printf("&ch%d,\n", i);
+      printf("\n");
     }
   }
   printf("};\n\n");
+
+  /* Undefined characters get an all-zero entry, which
+     glutBitmapCharacter treats as missing. */
+  printf("static const BitmapCharRec chars[] = {\n");
+  offset = 0;
+  for (i = first; i <= last; i++) {
+    cc = &captured[i - first];
+    if (!cc->defined) {
+      printf("{0,0,0,0,0,0},\n");
+    } else if (!cc->bitmap) {
+      printf("{0,0,0,0,%d,0},\n", cc->advance);
+    } else {
+      printf("{%d,%d,%d,%d,%d,%d},\n", cc->width, cc->height,
+        cc->xorig, cc->yorig, cc->advance, offset);
+      offset += cc->size;
+      free(cc->bitmap);
+    }
+  }
+  printf("};\n\n");
+  free(captured);
+
   printf("const BitmapFontRec %s = {\n", name);
-  printf("\"%s\",\n", xfont);
   printf("%d,\n", last - first + 1);
   printf("%d,\n", first);
-  printf("chars\n");
-  printf("};\n\n");
+  printf("chars,\n");
+  printf("bitmaps\n");
+  printf("};\n");
   XFreeFont(dpy, fontinfo);
 }
 
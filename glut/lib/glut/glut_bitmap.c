@@ -25,8 +25,24 @@ glutBitmapCharacter(GLUTbitmapFont font, int c)
   if (c < fontinfo->first ||
     c >= fontinfo->first + fontinfo->num_chars)
     return;
-  ch = fontinfo->ch[c - fontinfo->first];
-  if (ch) {
+  ch = &fontinfo->ch[c - fontinfo->first];
+  if (ch->width || ch->advance) {
+    GLsizei width = ch->width, height = ch->height;
+    const GLubyte *bitmap = fontinfo->bitmaps + ch->offset;
+
+#if defined(_WIN32)
+    /* XXX Work around Microsoft OpenGL 1.1 bug where glBitmap with
+       a height or width of zero does not advance the raster position
+       as specified by OpenGL. (Cosmo OpenGL does not have this bug.) */
+    static const GLubyte emptyBitmap[] = { 0x0 };
+
+    if (width == 0 || height == 0) {
+      width = 1;
+      height = 1;
+      bitmap = emptyBitmap;
+    }
+#endif
+
     /* Save current modes. */
     glGetIntegerv(GL_UNPACK_SWAP_BYTES, &swapbytes);
     glGetIntegerv(GL_UNPACK_LSB_FIRST, &lsbfirst);
@@ -44,8 +60,8 @@ glutBitmapCharacter(GLUTbitmapFont font, int c)
     glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
     glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    glBitmap(ch->width, ch->height, ch->xorig, ch->yorig,
-      ch->advance, 0, ch->bitmap);
+    glBitmap(width, height, ch->xorig, ch->yorig,
+      ch->advance, 0, bitmap);
     /* Restore saved modes. */
     glPixelStorei(GL_UNPACK_SWAP_BYTES, swapbytes);
     glPixelStorei(GL_UNPACK_LSB_FIRST, lsbfirst);
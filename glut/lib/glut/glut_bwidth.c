@@ -24,12 +24,8 @@ glutBitmapWidth(GLUTbitmapFont font, int c)
   if (c < fontinfo->first || c >= fontinfo->first + fontinfo->num_chars) {
     return 0;
   }
-  ch = fontinfo->ch[c - fontinfo->first];
-  if (ch) {
-    return ch->advance;
-  } else {
-    return 0;
-  }
+  ch = &fontinfo->ch[c - fontinfo->first];
+  return ch->advance;
 }
 
 int GLUTAPIENTRY 
@@ -49,10 +45,8 @@ glutBitmapLength(GLUTbitmapFont font, const unsigned char *string)
   for (; *string != '\0'; string++) {
     c = *string;
     if (c >= fontinfo->first && c < fontinfo->first + fontinfo->num_chars) {
-      ch = fontinfo->ch[c - fontinfo->first];
-      if (ch) {
-        length += ch->advance;
-      }
+      ch = &fontinfo->ch[c - fontinfo->first];
+      length += ch->advance;
     }
   }
   return length;
@@ -0,0 +1,290 @@
+
+/* Copyright (c) Mark J. Kilgard, 2026. */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* GLUT's one clock.  Timer deadlines, GLUT_ELAPSED_TIME, and
+   glutGetNanoseconds all read it, so none of them can be thrown
+   off by NTP or a user stepping the wall clock.  The time base is
+   the platform monotonic clock (CLOCK_MONOTONIC on Unix,
+   QueryPerformanceCounter on Win32).  The "-tsc" option to
+   glutInit instead reads the x86 time stamp counter directly,
+   calibrated against the monotonic clock, when the processor
+   advertises an invariant TSC.
+
+   Two clocks replace real time.  The "-virtualclock" option makes
+   time stand still except when the main loop would sleep until a
+   timer or idle deadline; then it jumps straight to the deadline,
+   so paced callbacks run back to back in deadline order and a run
+   repeats exactly.  glutClockFunc plugs in a program's own clock;
+   GLUT sleeps as if it ran at real speed. */
+
+#include <stdlib.h>
+#if !defined(_WIN32) && !defined(__vms)
+#include <time.h>
+#include <sys/resource.h>
+#endif
+
+#include "glutint.h"
+
+#if (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1400 && (defined(_M_IX86) || defined(_M_X64)))
+# define GLUT_HAS_TSC
+# ifdef _MSC_VER
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+#  include <x86intrin.h>
+# endif
+#endif
+
+/* Signed 64-bit integer; old Visual C++ cannot convert unsigned
+   __int64 to double. */
+#if defined(_MSC_VER) && _MSC_VER < 1300
+typedef __int64 GLUTticks;
+#else
+typedef long long GLUTticks;
+#endif
+
+#define NANOSECONDS_PER_SECOND 1000000000
+
+/* GLUT inter-file variables */
+int __glutClockSource = GLUT_CLOCK_MONOTONIC;
+
+static int beenhere = 0;
+static GLUTnanoseconds genesis;
+static int baseSource = GLUT_CLOCK_MONOTONIC;  /* glutInit's choice */
+static GLUTnanoseconds virtualNow;
+static GLUTnanoseconds (GLUTCALLBACK *programClock)(void);
+static GLUTnanoseconds programOffset;
+
+static GLUTnanoseconds
+monotonicNow(void)
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER count;
+
+  if (!frequency.QuadPart) {
+    QueryPerformanceFrequency(&frequency);
+  }
+  QueryPerformanceCounter(&count);
+  /* Whole seconds and remainder are scaled separately so
+     count * 10^9 cannot overflow. */
+  return (GLUTnanoseconds)
+    (count.QuadPart / frequency.QuadPart) * NANOSECONDS_PER_SECOND +
+    (GLUTnanoseconds)
+    (count.QuadPart % frequency.QuadPart) * NANOSECONDS_PER_SECOND /
+    frequency.QuadPart;
+#elif defined(__vms) && ( __VMS_VER < 70000000 )
+  struct timeval now;
+
+  /* One VMS tick is 100 nanoseconds. */
+  (void) sys$gettim(&now);
+  return (GLUTnanoseconds) now.val * 100;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (GLUTnanoseconds) now.tv_sec * NANOSECONDS_PER_SECOND +
+    now.tv_nsec;
+#else
+  /* No monotonic clock on this system; the wall clock is the
+     best available. */
+  struct timeval now;
+
+  GETTIMEOFDAY(&now);
+  return (GLUTnanoseconds) now.tv_sec * NANOSECONDS_PER_SECOND +
+    (GLUTnanoseconds) now.tv_usec * 1000;
+#endif
+}
+
+#ifdef GLUT_HAS_TSC
+static GLUTnanoseconds tscBaseTime;
+static GLUTnanoseconds tscBaseCount;
+static double tscNanosecondsPerTick;
+
+static int
+hasInvariantTSC(void)
+{
+#ifdef _MSC_VER
+  int regs[4];
+
+  __cpuid(regs, 0x80000000);
+  if ((unsigned int) regs[0] < 0x80000007) {
+    return 0;
+  }
+  __cpuid(regs, 0x80000007);
+  return (regs[3] >> 8) & 1;
+#else
+  unsigned int eax, ebx, ecx, edx;
+
+  if (__get_cpuid_max(0x80000000, NULL) < 0x80000007 ||
+    !__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  return (edx >> 8) & 1;
+#endif
+}
+
+static void
+calibrateTSC(void)
+{
+  GLUTnanoseconds start, stop;
+  GLUTnanoseconds startCount, stopCount;
+
+  /* Spin for 10 milliseconds of monotonic time; long enough
+     for the rate to be good to a few parts per million. */
+  start = monotonicNow();
+  startCount = __rdtsc();
+  do {
+    stop = monotonicNow();
+  } while (stop - start < 10000000);
+  stopCount = __rdtsc();
+  tscNanosecondsPerTick = (double) (GLUTticks) (stop - start) /
+    (double) (GLUTticks) (stopCount - startCount);
+  tscBaseTime = stop;
+  tscBaseCount = stopCount;
+}
+#endif /* GLUT_HAS_TSC */
+
+void
+__glutInitClock(int source)
+{
+  if (!beenhere) {
+    genesis = monotonicNow();
+    beenhere = 1;
+  }
+  if (source == GLUT_CLOCK_TSC && baseSource != GLUT_CLOCK_TSC) {
+#ifdef GLUT_HAS_TSC
+    if (hasInvariantTSC()) {
+      calibrateTSC();
+      baseSource = GLUT_CLOCK_TSC;
+    } else {
+      __glutWarning("-tsc ignored; processor lacks an invariant TSC.");
+    }
+#else
+    __glutWarning("-tsc option not supported on this processor.");
+#endif
+  } else if (source == GLUT_CLOCK_VIRTUAL &&
+    baseSource != GLUT_CLOCK_VIRTUAL) {
+    /* Start from zero glutGetNanoseconds so runs repeat exactly. */
+    virtualNow = genesis;
+    baseSource = GLUT_CLOCK_VIRTUAL;
+  }
+  /* A clock from glutClockFunc outranks glutInit's. */
+  if (__glutClockSource != GLUT_CLOCK_PROGRAM) {
+    __glutClockSource = baseSource;
+  }
+}
+
+/* Absolute time in nanoseconds, with an arbitrary origin. */
+GLUTnanoseconds
+__glutClockNow(void)
+{
+  switch (__glutClockSource) {
+#ifdef GLUT_HAS_TSC
+  case GLUT_CLOCK_TSC:
+    {
+      GLUTnanoseconds ticks = __rdtsc() - tscBaseCount;
+
+      return tscBaseTime +
+        (GLUTnanoseconds) ((double) (GLUTticks) ticks * tscNanosecondsPerTick);
+    }
+#endif
+  case GLUT_CLOCK_VIRTUAL:
+    return virtualNow;
+  case GLUT_CLOCK_PROGRAM:
+    return programClock() + programOffset;
+  default:
+    return monotonicNow();
+  }
+}
+
+/* Moves the virtual clock up to deadline, never back. */
+void
+__glutAdvanceClockTo(GLUTnanoseconds deadline)
+{
+  if (deadline > virtualNow) {
+    virtualNow = deadline;
+  }
+}
+
+/* CPU time, user plus system, the process has used. */
+GLUTnanoseconds
+__glutProcessTime(void)
+{
+#if defined(_WIN32)
+  FILETIME creation, exited, kernel, user;
+
+  if (!GetProcessTimes(GetCurrentProcess(),
+      &creation, &exited, &kernel, &user)) {
+    return 0;
+  }
+  /* FILETIMEs count 100 nanosecond units. */
+  return (((GLUTnanoseconds) kernel.dwHighDateTime << 32 | kernel.dwLowDateTime) +
+    ((GLUTnanoseconds) user.dwHighDateTime << 32 | user.dwLowDateTime)) * 100;
+#elif defined(__vms)
+  return 0;  /* not measured */
+#else
+  struct rusage usage;
+
+  getrusage(RUSAGE_SELF, &usage);
+  return (GLUTnanoseconds) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) *
+    NANOSECONDS_PER_SECOND +
+    (GLUTnanoseconds) (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000;
+#endif
+}
+
+/* The __glutClockNow time glutGetNanoseconds counts from. */
+GLUTnanoseconds
+__glutClockGenesis(void)
+{
+  if (!beenhere) {
+    __glutInitClock(0);
+  }
+  return genesis;
+}
+
+GLUTnanoseconds GLUTAPIENTRY
+glutGetNanoseconds(void)
+{
+  GLUTnanoseconds origin = __glutClockGenesis();
+
+  return __glutClockNow() - origin;
+}
+
+void GLUTAPIENTRY
+glutClockFunc(GLUTnanoseconds (GLUTCALLBACK *func)(void))
+{
+  GLUTnanoseconds now;
+
+  (void) __glutClockGenesis();
+  now = __glutClockNow();
+  if (func) {
+    /* Offset the program's clock so GLUT's time carries on from
+       now; pending deadlines then stay as far off as they were. */
+    programClock = func;
+    programOffset = now - func();
+    __glutClockSource = GLUT_CLOCK_PROGRAM;
+  } else if (__glutClockSource == GLUT_CLOCK_PROGRAM) {
+    /* A virtual clock resumes from the program's time; a real
+       one cannot. */
+    if (baseSource == GLUT_CLOCK_VIRTUAL) {
+      virtualNow = now;
+    }
+    __glutClockSource = baseSource;
+  }
+}
+
+void GLUTAPIENTRY
+glutAdvanceClock(GLUTnanoseconds delta)
+{
+  if (__glutClockSource != GLUT_CLOCK_VIRTUAL) {
+    __glutWarning("glutAdvanceClock: clock is not virtual.");
+    return;
+  }
+  virtualNow += delta;
+}
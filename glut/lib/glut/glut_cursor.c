@@ -196,7 +196,9 @@ glutSetCursor(int cursor)
   }
 #else
   __glutCurrentWindow->cursor = cursor;
-  __glutSetCursor(__glutCurrentWindow);
+  if (!__glutNullWindowSystem) {
+    __glutSetCursor(__glutCurrentWindow);
+  }
 #endif
 }
 /* ENDCENTRY */
@@ -0,0 +1,406 @@
+
+/* Copyright (c) Mark J. Kilgard, 2026. */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* OpenGL for the null window system.  "glutInit -egl" is -null
+   with an EGL context for each window, rendering to a pbuffer the
+   size of the window, so display callbacks, glutSwapBuffers and
+   glReadPixels work with no X server or GPU (Mesa's llvmpipe, say).
+   Where EGL has no pbuffer configs but does have surfaceless
+   contexts, windows get a context with no surface at all and
+   programs render to framebuffer objects of their own.  libEGL is
+   loaded only when -egl is given, so GLUT programs need not link
+   with it. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "glutint.h"
+
+GLboolean __glutUseEGL = GL_FALSE;
+
+/* Define GLUT_NO_EGL to build on Linux systems lacking the EGL
+   headers. */
+#if defined(__linux__) && !defined(GLUT_NO_EGL)
+#define GLUT_USE_EGL
+#endif
+
+#ifdef GLUT_USE_EGL
+
+#include <dlfcn.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+static struct {
+  PFNEGLGETPROCADDRESSPROC GetProcAddress;
+  PFNEGLGETDISPLAYPROC GetDisplay;
+  PFNEGLINITIALIZEPROC Initialize;
+  PFNEGLQUERYSTRINGPROC QueryString;
+  PFNEGLBINDAPIPROC BindAPI;
+  PFNEGLCHOOSECONFIGPROC ChooseConfig;
+  PFNEGLGETCONFIGATTRIBPROC GetConfigAttrib;
+  PFNEGLCREATECONTEXTPROC CreateContext;
+  PFNEGLDESTROYCONTEXTPROC DestroyContext;
+  PFNEGLQUERYCONTEXTPROC QueryContext;
+  PFNEGLCREATEPBUFFERSURFACEPROC CreatePbufferSurface;
+  PFNEGLDESTROYSURFACEPROC DestroySurface;
+  PFNEGLMAKECURRENTPROC MakeCurrent;
+  PFNEGLGETCURRENTCONTEXTPROC GetCurrentContext;
+  PFNEGLGETCURRENTSURFACEPROC GetCurrentSurface;
+  PFNEGLSWAPBUFFERSPROC SwapBuffers;
+} egl;
+
+static EGLDisplay display = EGL_NO_DISPLAY;
+static GLboolean surfaceless = GL_FALSE;  /* if windows lack pbuffers */
+
+static int
+loadEGL(void)
+{
+  void *dso = dlopen("libEGL.so.1", RTLD_LAZY);
+
+  if (!dso) {
+    return 0;
+  }
+#define LOAD(name, type) \
+  if (!(egl.name = (type) dlsym(dso, "egl" #name))) { \
+    return 0; \
+  }
+  LOAD(GetProcAddress, PFNEGLGETPROCADDRESSPROC);
+  LOAD(GetDisplay, PFNEGLGETDISPLAYPROC);
+  LOAD(Initialize, PFNEGLINITIALIZEPROC);
+  LOAD(QueryString, PFNEGLQUERYSTRINGPROC);
+  LOAD(BindAPI, PFNEGLBINDAPIPROC);
+  LOAD(ChooseConfig, PFNEGLCHOOSECONFIGPROC);
+  LOAD(GetConfigAttrib, PFNEGLGETCONFIGATTRIBPROC);
+  LOAD(CreateContext, PFNEGLCREATECONTEXTPROC);
+  LOAD(DestroyContext, PFNEGLDESTROYCONTEXTPROC);
+  LOAD(QueryContext, PFNEGLQUERYCONTEXTPROC);
+  LOAD(CreatePbufferSurface, PFNEGLCREATEPBUFFERSURFACEPROC);
+  LOAD(DestroySurface, PFNEGLDESTROYSURFACEPROC);
+  LOAD(MakeCurrent, PFNEGLMAKECURRENTPROC);
+  LOAD(GetCurrentContext, PFNEGLGETCURRENTCONTEXTPROC);
+  LOAD(GetCurrentSurface, PFNEGLGETCURRENTSURFACEPROC);
+  LOAD(SwapBuffers, PFNEGLSWAPBUFFERSPROC);
+#undef LOAD
+  return 1;
+}
+
+static int
+hasExtension(const char *extensions, const char *name)
+{
+  size_t len = strlen(name);
+  const char *s = extensions;
+
+  while (s && (s = strstr(s, name))) {
+    if ((s == extensions || s[-1] == ' ') &&
+      (s[len] == ' ' || s[len] == '\0')) {
+      return 1;
+    }
+    s += len;
+  }
+  return 0;
+}
+
+/* Chooses the config for the current display mode, needing
+   pbuffer support unless windows are surfaceless. */
+static int
+chooseConfig(EGLConfig * config)
+{
+  EGLint attribs[32], n = 0, count;
+
+  if (GLUT_WIND_IS_INDEX(__glutDisplayMode)) {
+    __glutFatalError("color index windows not supported with -egl.");
+  }
+  attribs[n++] = EGL_RENDERABLE_TYPE;
+  attribs[n++] = EGL_OPENGL_BIT;
+  attribs[n++] = EGL_SURFACE_TYPE;
+  attribs[n++] = surfaceless ? 0 : EGL_PBUFFER_BIT;
+  attribs[n++] = EGL_RED_SIZE;
+  attribs[n++] = 1;
+  attribs[n++] = EGL_GREEN_SIZE;
+  attribs[n++] = 1;
+  attribs[n++] = EGL_BLUE_SIZE;
+  attribs[n++] = 1;
+  if (GLUT_WIND_HAS_ALPHA(__glutDisplayMode)) {
+    attribs[n++] = EGL_ALPHA_SIZE;
+    attribs[n++] = 1;
+  }
+  if (GLUT_WIND_HAS_DEPTH(__glutDisplayMode)) {
+    attribs[n++] = EGL_DEPTH_SIZE;
+    attribs[n++] = 1;
+  }
+  if (GLUT_WIND_HAS_STENCIL(__glutDisplayMode)) {
+    attribs[n++] = EGL_STENCIL_SIZE;
+    attribs[n++] = 1;
+  }
+  if (GLUT_WIND_IS_MULTISAMPLE(__glutDisplayMode)) {
+    attribs[n++] = EGL_SAMPLE_BUFFERS;
+    attribs[n++] = 1;
+  }
+  /* EGL has no accumulation or stereo buffers to ask for. */
+  attribs[n] = EGL_NONE;
+  return egl.ChooseConfig(display, attribs, config, 1, &count) &&
+    count > 0;
+}
+
+void
+__glutEGLOpenDisplay(void)
+{
+  PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay;
+  const char *extensions;
+  EGLConfig config;
+
+  if (!loadEGL()) {
+    __glutFatalError("-egl could not load libEGL.so.1.");
+  }
+  /* Mesa's surfaceless platform needs no X server or GPU; failing
+     that, take whatever EGL defaults to. */
+  extensions = egl.QueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+    egl.GetProcAddress("eglGetPlatformDisplayEXT");
+  if (getPlatformDisplay &&
+    hasExtension(extensions, "EGL_MESA_platform_surfaceless")) {
+    display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+      EGL_DEFAULT_DISPLAY, NULL);
+  }
+  if (display == EGL_NO_DISPLAY) {
+    display = egl.GetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+  if (display == EGL_NO_DISPLAY || !egl.Initialize(display, NULL, NULL)) {
+    __glutFatalError("-egl could not initialize an EGL display.");
+  }
+  if (!egl.BindAPI(EGL_OPENGL_API)) {
+    __glutFatalError("-egl found no OpenGL support in EGL.");
+  }
+  if (!chooseConfig(&config)) {
+    if (!hasExtension(egl.QueryString(display, EGL_EXTENSIONS),
+        "EGL_KHR_surfaceless_context")) {
+      __glutFatalError("-egl found neither pbuffers nor surfaceless contexts.");
+    }
+    __glutWarning("-egl found no pbuffers; windows are surfaceless.");
+    surfaceless = GL_TRUE;
+  }
+  __glutUseEGL = GL_TRUE;
+}
+
+static EGLSurface
+createSurface(EGLConfig config, int width, int height)
+{
+  EGLint attribs[5];
+  EGLSurface surface;
+
+  if (surfaceless) {
+    return EGL_NO_SURFACE;
+  }
+  attribs[0] = EGL_WIDTH;
+  attribs[1] = width;
+  attribs[2] = EGL_HEIGHT;
+  attribs[3] = height;
+  attribs[4] = EGL_NONE;
+  surface = egl.CreatePbufferSurface(display, config, attribs);
+  if (surface == EGL_NO_SURFACE) {
+    __glutFatalError("failed to create %dx%d EGL pbuffer.", width, height);
+  }
+  return surface;
+}
+
+/* The config a window's context was created with. */
+static EGLConfig
+windowConfig(GLUTwindow * window)
+{
+  EGLint attribs[3], count;
+  EGLConfig config = NULL;
+
+  attribs[0] = EGL_CONFIG_ID;
+  egl.QueryContext(display, (EGLContext) window->ctx, EGL_CONFIG_ID,
+    &attribs[1]);
+  attribs[2] = EGL_NONE;
+  egl.ChooseConfig(display, attribs, &config, 1, &count);
+  return config;
+}
+
+GLXContext
+__glutEGLCreateContext(GLUTwindow * window, int width, int height)
+{
+  EGLConfig config;
+  EGLContext ctx;
+
+  if (!chooseConfig(&config)) {
+    __glutFatalError(
+      "visual with necessary capabilities not found.");
+  }
+  ctx = egl.CreateContext(display, config, EGL_NO_CONTEXT, NULL);
+  if (ctx == EGL_NO_CONTEXT) {
+    __glutFatalError(
+      "failed to create OpenGL rendering context.");
+  }
+  window->eglSurface = createSurface(config, width, height);
+  return (GLXContext) ctx;
+}
+
+void
+__glutEGLDestroyContext(GLUTwindow * window)
+{
+  if (window->eglSurface != EGL_NO_SURFACE) {
+    egl.DestroySurface(display, (EGLSurface) window->eglSurface);
+  }
+  egl.DestroyContext(display, (EGLContext) window->ctx);
+}
+
+/* Pbuffers cannot change size, so a resized window gets a new
+   one. */
+void
+__glutEGLResizeWindow(GLUTwindow * window)
+{
+  EGLSurface old = (EGLSurface) window->eglSurface;
+
+  if (old == EGL_NO_SURFACE) {
+    return;
+  }
+  window->eglSurface = createSurface(windowConfig(window),
+    window->width, window->height);
+  if (egl.GetCurrentSurface(EGL_DRAW) == old) {
+    egl.MakeCurrent(display, (EGLSurface) window->eglSurface,
+      (EGLSurface) window->eglSurface, (EGLContext) window->ctx);
+  }
+  egl.DestroySurface(display, old);
+}
+
+int
+__glutEGLMakeCurrent(GLUTwindow * window)
+{
+  if (!window) {
+    return egl.MakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+      EGL_NO_CONTEXT);
+  }
+  return egl.MakeCurrent(display, (EGLSurface) window->eglSurface,
+    (EGLSurface) window->eglSurface, (EGLContext) window->ctx);
+}
+
+int
+__glutEGLIsCurrent(GLUTwindow * window)
+{
+  return egl.GetCurrentContext() == (EGLContext) window->ctx &&
+    egl.GetCurrentSurface(EGL_DRAW) == (EGLSurface) window->eglSurface;
+}
+
+GLXContext
+__glutEGLGetCurrentContext(void)
+{
+  return (GLXContext) egl.GetCurrentContext();
+}
+
+void
+__glutEGLSwapBuffers(GLUTwindow * window)
+{
+  if (window->eglSurface != EGL_NO_SURFACE) {
+    egl.SwapBuffers(display, (EGLSurface) window->eglSurface);
+  }
+}
+
+/* Answers the glutGet framebuffer queries for the current
+   window. */
+int
+__glutEGLGet(GLenum param, int *value)
+{
+  EGLConfig config = windowConfig(__glutCurrentWindow);
+  EGLint attrib;
+
+  switch (param) {
+  case GLUT_WINDOW_BUFFER_SIZE:
+    attrib = EGL_BUFFER_SIZE;
+    break;
+  case GLUT_WINDOW_STENCIL_SIZE:
+    attrib = EGL_STENCIL_SIZE;
+    break;
+  case GLUT_WINDOW_DEPTH_SIZE:
+    attrib = EGL_DEPTH_SIZE;
+    break;
+  case GLUT_WINDOW_RED_SIZE:
+    attrib = EGL_RED_SIZE;
+    break;
+  case GLUT_WINDOW_GREEN_SIZE:
+    attrib = EGL_GREEN_SIZE;
+    break;
+  case GLUT_WINDOW_BLUE_SIZE:
+    attrib = EGL_BLUE_SIZE;
+    break;
+  case GLUT_WINDOW_ALPHA_SIZE:
+    attrib = EGL_ALPHA_SIZE;
+    break;
+  case GLUT_WINDOW_NUM_SAMPLES:
+    attrib = EGL_SAMPLES;
+    break;
+  case GLUT_WINDOW_FORMAT_ID:
+    attrib = EGL_CONFIG_ID;
+    break;
+  default:
+    return 0;
+  }
+  if (!config || !egl.GetConfigAttrib(display, config, attrib, value)) {
+    *value = 0;
+  }
+  return 1;
+}
+
+#elif !defined(_WIN32)
+
+void
+__glutEGLOpenDisplay(void)
+{
+  __glutFatalError("-egl not supported by this GLUT build.");
+}
+
+GLXContext
+__glutEGLCreateContext(GLUTwindow * window, int width, int height)
+{
+  return NULL;
+}
+
+void
+__glutEGLDestroyContext(GLUTwindow * window)
+{
+}
+
+void
+__glutEGLResizeWindow(GLUTwindow * window)
+{
+}
+
+int
+__glutEGLMakeCurrent(GLUTwindow * window)
+{
+  return 0;
+}
+
+int
+__glutEGLIsCurrent(GLUTwindow * window)
+{
+  return 0;
+}
+
+GLXContext
+__glutEGLGetCurrentContext(void)
+{
+  return NULL;
+}
+
+void
+__glutEGLSwapBuffers(GLUTwindow * window)
+{
+}
+
+int
+__glutEGLGet(GLenum param, int *value)
+{
+  return 0;
+}
+
+#endif /* GLUT_USE_EGL */
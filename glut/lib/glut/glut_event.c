@@ -68,17 +68,27 @@ extern int SYS$CANTIM(unsigned int request_id, unsigned int mode);
 
 #include "glutint.h"
 
-static GLUTtimer *freeTimerList = NULL;
-
 GLUTidleCB __glutIdleFunc = NULL;
-GLUTtimer *__glutTimerList = NULL;
-#ifdef SUPPORT_FORTRAN
-GLUTtimer *__glutNewTimer;
-#endif
 GLUTwindow *__glutWindowWorkList = NULL;
+GLUTwindow *__glutWindowWorkPending = NULL;  /* oldest first */
 GLUTmenu *__glutMappedMenu;
 GLUTmenu *__glutCurrentMenu = NULL;
 
+/* glutIdlePolicy state.  Any policy but GLUT_IDLE_CONTINUOUS lets the
+   main loop sleep in its event wait between idle calls. */
+static int idlePolicy = GLUT_IDLE_CONTINUOUS;
+static GLUTnanoseconds idleInterval = 0;
+static GLUTnanoseconds idleNext = 0;  /* when the idle func may next run */
+static int idleEvents = 1;            /* events came since it last ran */
+
+/* glutCoalesceEvents mask. */
+static int coalesceMask = 0;
+
+/* glutGetMainLoopLoad counts. */
+static int loopWakeups = 0;
+static GLUTnanoseconds loadStart = 0;
+static GLUTnanoseconds loadStartCPU = 0;
+
 void (*__glutUpdateInputDeviceMaskFunc) (GLUTwindow *);
 #ifndef _WIN32
 void (*__glutMenuItemEnterOrLeave)(GLUTmenuItem * item, int num, int type) = NULL;
@@ -96,6 +106,8 @@ Atom __glutNetWMStateFullscreen = None;
 /* Modifier mask of ~0 implies not in core input callback. */
 unsigned int __glutModifierMask = (unsigned int) ~0;
 int __glutWindowDamaged = 0;
+int __glutCoalescedMotion = 0;
+int __glutCoalescedReshape = 0;
 
 void GLUTAPIENTRY
 glutIdleFunc(GLUTidleCB idleFunc)
@@ -104,70 +116,77 @@ glutIdleFunc(GLUTidleCB idleFunc)
 }
 
 void GLUTAPIENTRY
-glutTimerFunc(unsigned int interval, GLUTtimerCB timerFunc, int value)
+glutCoalesceEvents(int mask)
 {
-  GLUTtimer *timer, *other;
-  GLUTtimer **prevptr;
-  GLUTtimeval now;
+  coalesceMask = mask & (GLUT_COALESCE_MOTION | GLUT_COALESCE_RESHAPE);
+}
 
-  if (!timerFunc) {
-    return;
-  }
+/* The display refresh period, or 60 Hz's when the window system
+   does not say. */
+static GLUTnanoseconds
+refreshPeriod(void)
+{
+  int hertz = 60;
+#ifdef _WIN32
+  HDC hdc = GetDC(NULL);
 
-  if (freeTimerList) {
-    timer = freeTimerList;
-    freeTimerList = timer->next;
-  } else {
-    timer = (GLUTtimer *) malloc(sizeof(GLUTtimer));
-    if (!timer) {
-      __glutFatalError("out of memory.");
-    }
+  /* Windows 95 and 98 always return zero for VREFRESH, and 1
+     means the hardware default. */
+  if (GetDeviceCaps(hdc, VREFRESH) > 1) {
+    hertz = GetDeviceCaps(hdc, VREFRESH);
   }
-
-  timer->func = timerFunc;
-#if defined(__vms) && ( __VMS_VER < 70000000 )
-  /* VMS time is expressed in units of 100 ns */
-  timer->timeout.val = interval * TICKS_PER_MILLISECOND;
-#else
-  timer->timeout.tv_sec = (int) interval / 1000;
-  timer->timeout.tv_usec = (int) (interval % 1000) * 1000;
+  ReleaseDC(NULL, hdc);
 #endif
-  timer->value = value;
-  timer->next = NULL;
-  GETTIMEOFDAY(&now);
-  ADD_TIME(timer->timeout, timer->timeout, now);
-  prevptr = &__glutTimerList;
-  other = *prevptr;
-  while (other && IS_AFTER(other->timeout, timer->timeout)) {
-    prevptr = &other->next;
-    other = *prevptr;
+  return 1000000000 / hertz;
+}
+
+void GLUTAPIENTRY
+glutIdlePolicy(int policy, GLUTnanoseconds interval)
+{
+  switch (policy) {
+  case GLUT_IDLE_CONTINUOUS:
+  case GLUT_IDLE_AFTER_EVENTS:
+    idleInterval = 0;
+    break;
+  case GLUT_IDLE_INTERVAL:
+    idleInterval = interval;
+    break;
+  case GLUT_IDLE_REFRESH:
+    idleInterval = refreshPeriod();
+    break;
+  default:
+    __glutWarning("glutIdlePolicy: unknown policy %d.", policy);
+    return;
   }
-  timer->next = other;
-#ifdef SUPPORT_FORTRAN
-  __glutNewTimer = timer;  /* for Fortran binding! */
-#endif
-  *prevptr = timer;
+  idlePolicy = policy;
+  idleNext = 0;
+  idleEvents = 1;
 }
 
-void
-handleTimeouts(void)
+int GLUTAPIENTRY
+glutGetMainLoopLoad(GLUTnanoseconds * cpu, GLUTnanoseconds * elapsed,
+  int reset)
 {
-  GLUTtimeval now;
-  GLUTtimer *timer;
-
-  /* Assumption is that __glutTimerList is already determined
-     to be non-NULL. */
-  GETTIMEOFDAY(&now);
-  while (IS_AT_OR_AFTER(__glutTimerList->timeout, now)) {
-    timer = __glutTimerList;
-    timer->func(timer->value);
-    __glutTimerList = timer->next;
-    timer->next = freeTimerList;
-    freeTimerList = timer;
-    if (!__glutTimerList) {
-      break;
-    }
+  GLUTnanoseconds now = __glutClockNow();
+  GLUTnanoseconds nowCPU = __glutProcessTime();
+  int wakeups = loopWakeups;
+
+  if (!loadStart) {
+    loadStart = now;
+    loadStartCPU = nowCPU;
   }
+  if (cpu) {
+    *cpu = nowCPU - loadStartCPU;
+  }
+  if (elapsed) {
+    *elapsed = now - loadStart;
+  }
+  if (reset) {
+    loopWakeups = 0;
+    loadStart = now;
+    loadStartCPU = nowCPU;
+  }
+  return wakeups;
 }
 
 void
@@ -279,6 +298,58 @@ purgeStaleWindow(Window win)
   }
 }
 
+/* The null window system queues its events within GLUT rather
+   than in Xlib; these pick whichever queue is in use. */
+static int
+eventsQueued(void)
+{
+  if (__glutNullWindowSystem) {
+    return __glutNullEventsQueued();
+  }
+  return XEventsQueued(__glutDisplay, QueuedAfterReading);
+}
+
+static void
+peekEvent(XEvent * event)
+{
+  if (__glutNullWindowSystem) {
+    __glutNullPeekEvent(event);
+  } else {
+    XPeekEvent(__glutDisplay, event);
+  }
+}
+
+static void
+nextEvent(XEvent * event)
+{
+  if (__glutNullWindowSystem) {
+    __glutNullNextEvent(event);
+  } else {
+    XNextEvent(__glutDisplay, event);
+  }
+}
+#endif
+
+static int
+eventsPending(void)
+{
+#ifndef _WIN32
+  if (__glutNullWindowSystem) {
+    return __glutNullEventsQueued();
+  }
+#endif
+  return XPending(__glutDisplay);
+}
+
+static void
+flushEvents(void)
+{
+  if (!__glutNullWindowSystem) {
+    XFlush(__glutDisplay);
+  }
+}
+
+#ifndef _WIN32
 # ifndef __vms  /* See comment about VMS below. */
 
 /* Unlike XNextEvent, if a signal arrives,
@@ -288,31 +359,22 @@ purgeStaleWindow(Window win)
    glutIdleFunc in a signal handler to register an idle func
    and then immediately get dropped into the idle func (after
    returning from the signal handler).  The idea is to make
-   GLUT's main loop reliably interruptible by signals. */
+   GLUT's main loop reliably interruptible by signals.  It
+   returns zero too after running glutWatchFd callbacks or on a
+   glutWakeup, so the main loop sees what they did. */
 static int
 interruptibleXNextEvent(Display * dpy, XEvent * event)
 {
-  fd_set fds;
-  int rc;
-
   /* Flush X protocol since XPending does not do this
      implicitly. */
-  XFlush(__glutDisplay);
+  flushEvents();
   for (;;) {
-    if (XPending(__glutDisplay)) {
-      XNextEvent(dpy, event);
+    if (eventsPending()) {
+      nextEvent(event);
       return 1;
     }
-    FD_ZERO(&fds);
-    FD_SET(__glutConnectionFD, &fds);
-    rc = select(__glutConnectionFD + 1, &fds,
-      NULL, NULL, NULL);
-    if (rc < 0) {
-      if (errno == EINTR) {
-        return 0;
-      } else {
-        __glutFatalError("select error.");
-      }
+    if (!__glutWaitForEvents(GLUT_WAIT_FOREVER)) {
+      return 0;
     }
   }
 }
@@ -357,6 +419,19 @@ processEventsAndTimeouts(void)
         XRefreshKeyboardMapping((XMappingEvent *) & event);
         break;
       case ConfigureNotify:
+        if (coalesceMask & GLUT_COALESCE_RESHAPE) {
+          /* Only the last of back to back configures for a
+             window matters to the reshape callback. */
+          while (eventsQueued() > 0) {
+            peekEvent(&ahead);
+            if (ahead.type != ConfigureNotify ||
+              ahead.xconfigure.window != event.xconfigure.window) {
+              break;
+            }
+            nextEvent(&event);
+            __glutCoalescedReshape++;
+          }
+        }
         window = __glutGetWindow(event.xconfigure.window);
         if (window) {
           if (window->win != event.xconfigure.window) {
@@ -375,9 +450,13 @@ processEventsAndTimeouts(void)
             window->width = width;
             window->height = height;
             __glutSetWindow(window);
-            /* Do not execute OpenGL out of sequence with
-               respect to the XResizeWindow request! */
-            glXWaitX();
+            if (__glutUseEGL) {
+              __glutEGLResizeWindow(window);
+            } else if (!__glutNullWindowSystem) {
+              /* Do not execute OpenGL out of sequence with
+                 respect to the XResizeWindow request! */
+              glXWaitX();
+            }
             window->reshape(width, height);
             window->forceReshape = False;
             /* A reshape should be considered like posting a
@@ -392,14 +471,13 @@ processEventsAndTimeouts(void)
         break;
       case Expose:
         /* compress expose events */
-        while (XEventsQueued(__glutDisplay, QueuedAfterReading)
-          > 0) {
-          XPeekEvent(__glutDisplay, &ahead);
+        while (eventsQueued() > 0) {
+          peekEvent(&ahead);
           if (ahead.type != Expose ||
             ahead.xexpose.window != event.xexpose.window) {
             break;
           }
-          XNextEvent(__glutDisplay, &event);
+          nextEvent(&event);
         }
         if (event.xexpose.count == 0) {
           GLUTmenu *menu;
@@ -438,7 +516,8 @@ processEventsAndTimeouts(void)
             /* Make sure that __glutGetMenuByNum is only called if there
                really is a menu present. */
             if ((menuNum > 0) && (menu = __glutGetMenuByNum(menuNum))) {
-              if (event.type == ButtonPress && !__glutMappedMenu) {
+              if (event.type == ButtonPress && !__glutMappedMenu &&
+                !__glutNullWindowSystem) {
                 __glutStartMenu(menu, window,
                   event.xbutton.x_root, event.xbutton.y_root,
                   event.xbutton.x, event.xbutton.y);
@@ -447,7 +526,8 @@ processEventsAndTimeouts(void)
                 /* Ignore a release of a button with a menu
                    attatched to it when no menu is popped up,
                    or ignore a press when another menu is
-                   already popped up. */
+                   already popped up (or when there is no window
+                   system to pop one up on). */
               }
             } else if (window->mouse) {
               __glutSetWindow(window);
@@ -467,6 +547,23 @@ processEventsAndTimeouts(void)
         }
         break;
       case MotionNotify:
+        if (coalesceMask & GLUT_COALESCE_MOTION) {
+          /* Skip to the last of back to back motions in a window
+             with the same buttons down, so they still go to the
+             same callback.  Anything between them, a button press
+             say, ends the run, so nothing is reordered. */
+          while (eventsQueued() > 0) {
+            peekEvent(&ahead);
+            if (ahead.type != MotionNotify ||
+              ahead.xmotion.window != event.xmotion.window ||
+              (ahead.xmotion.state ^ event.xmotion.state) &
+              (Button1Mask | Button2Mask | Button3Mask)) {
+              break;
+            }
+            nextEvent(&event);
+            __glutCoalescedMotion++;
+          }
+        }
         if (!__glutMappedMenu) {
           window = __glutGetWindow(event.xmotion.window);
           if (window) {
@@ -511,15 +608,15 @@ processEventsAndTimeouts(void)
              repeated keys as such KeyRelease/KeyPress pairs. */
 
           if (window->ignoreKeyRepeat) {
-            if (XEventsQueued(__glutDisplay, QueuedAfterReading)) {
-              XPeekEvent(__glutDisplay, &ahead);
+            if (eventsQueued()) {
+              peekEvent(&ahead);
               if (ahead.type == KeyPress
                 && ahead.xkey.window == event.xkey.window
                 && ahead.xkey.keycode == event.xkey.keycode
                 && ahead.xkey.time == event.xkey.time) {
                 /* Pop off the repeated KeyPress and ignore
                    the auto repeated KeyRelease/KeyPress pair. */
-                XNextEvent(__glutDisplay, &event);
+                nextEvent(&event);
                 break;
               }
             }
@@ -530,8 +627,12 @@ processEventsAndTimeouts(void)
           char tmp[1];
           int rc;
 
-          rc = XLookupString(&event.xkey, tmp, sizeof(tmp),
-            NULL, NULL);
+          if (__glutNullWindowSystem) {
+            rc = __glutNullLookupString(&event.xkey, tmp);
+          } else {
+            rc = XLookupString(&event.xkey, tmp, sizeof(tmp),
+              NULL, NULL);
+          }
           if (rc) {
             __glutSetWindow(window);
             __glutModifierMask = event.xkey.state;
@@ -584,7 +685,11 @@ processEventsAndTimeouts(void)
 #define XK_KP_Delete            0xFF9F
 #endif
 
-          ks = XLookupKeysym((XKeyEvent *) & event, 0);
+          if (__glutNullWindowSystem) {
+            ks = __glutNullLookupKeysym(&event.xkey);
+          } else {
+            ks = XLookupKeysym((XKeyEvent *) & event, 0);
+          }
           /* XXX Verbose, but makes no assumptions about keysym
              layout. */
           switch (ks) {
@@ -741,11 +846,11 @@ processEventsAndTimeouts(void)
                    the overlay, not an actual leave from the
                    GLUT window. */
 
-                if (XEventsQueued(__glutDisplay, QueuedAfterReading)) {
-                  XPeekEvent(__glutDisplay, &ahead);
+                if (eventsQueued()) {
+                  peekEvent(&ahead);
                   if (ahead.type == EnterNotify &&
                     __glutGetWindow(ahead.xcrossing.window) == window) {
-                    XNextEvent(__glutDisplay, &event);
+                    nextEvent(&event);
                     break;
                   }
                 }
@@ -830,38 +935,48 @@ processEventsAndTimeouts(void)
       }
     }
 #endif /* _WIN32 */
-    if (__glutTimerList) {
-      handleTimeouts();
+    if (__glutTimerCount) {
+      __glutHandleTimeouts();
     }
   }
-  while (XPending(__glutDisplay));
+  while (eventsPending());
 }
 
+/* With the virtual clock, time passes only while the main loop
+   would sleep, so poll instead and, if nothing turned up, jump the
+   clock to the deadline. */
 static void
-waitForSomething(void)
+virtualWait(GLUTnanoseconds timeout)
+{
+  int quiet = 1;
+
+#if !defined(_WIN32) && !(defined(__vms) && ( __VMS_VER < 70000000 ))
+  quiet = __glutWaitForEvents(0);
+#endif
+  if (quiet && !eventsPending()) {
+    __glutAdvanceClockTo(timeout);
+  }
+}
+
+/* Waits for events until timeout, a __glutClockNow time. */
+static void
+waitForSomething(GLUTnanoseconds timeout)
 {
 #if defined(__vms) && ( __VMS_VER < 70000000 )
-  static GLUTtimeval zerotime =
-  {0};
+  struct timeval waittime;
   unsigned int timer_efn;
 # define timer_id 'glut' /* random :-) number */
   unsigned int wait_mask;
-#else
-  static GLUTtimeval zerotime =
-  {0, 0};
-# ifndef _WIN32
-  fd_set fds;
-# endif
-#endif
-  GLUTtimeval now, timeout, waittime;
-#ifndef _WIN32
+  GLUTnanoseconds now;
   int rc;
+#elif defined(_WIN32)
+  GLUTnanoseconds now, delta;
 #endif
 
   /* Flush X protocol since XPending does not do this
      implicitly. */
-  XFlush(__glutDisplay);
-  if (XPending(__glutDisplay)) {
+  flushEvents();
+  if (eventsPending()) {
     /* It is possible (but quite rare) that XFlush may have
        needed to wait for a writable X connection file
        descriptor, and in the process, may have had to read off
@@ -873,11 +988,14 @@ waitForSomething(void)
        select. */
     goto immediatelyHandleXinput;
   }
+  if (__glutClockSource == GLUT_CLOCK_VIRTUAL) {
+    virtualWait(timeout);
+    goto checkForInput;
+  }
 #if defined(__vms) && ( __VMS_VER < 70000000 )
-  timeout = __glutTimerList->timeout;
-  GETTIMEOFDAY(&now);
+  now = __glutClockNow();
   wait_mask = 1 << (__glutConnectionFD & 31);
-  if (IS_AFTER(now, timeout)) {
+  if (timeout > now) {
     /* We need an event flag for the timer. */
     /* XXX The `right' way to do this is to use LIB$GET_EF, but
        since it needs to be in the same cluster as the EFN for
@@ -887,7 +1005,9 @@ waitForSomething(void)
       timer_efn = __glutConnectionFD + 1;
     }
     rc = SYS$CLREF(timer_efn);
-    rc = SYS$SETIMR(timer_efn, &timeout, NULL, timer_id, 0);
+    /* A negative VMS time is a delta in 100 ns ticks. */
+    waittime.val = -(__int64) ((timeout - now + 99) / 100);
+    rc = SYS$SETIMR(timer_efn, &waittime, NULL, timer_id, 0);
     wait_mask |= 1 << (timer_efn & 31);
   } else {
     timer_efn = 0;
@@ -900,63 +1020,112 @@ waitForSomething(void)
      above.  Can any of the SYS$ routines above fail? */
 #else /* not vms6.2 or lower */
 # ifndef _WIN32
-  FD_ZERO(&fds);
-  FD_SET(__glutConnectionFD, &fds);
-# endif
-  timeout = __glutTimerList->timeout;
-  GETTIMEOFDAY(&now);
-  if (IS_AFTER(now, timeout)) {
-    TIMEDELTA(waittime, timeout, now);
+  (void) __glutWaitForEvents(timeout);
+# else
+  now = __glutClockNow();
+  if (timeout > now) {
+    delta = timeout - now;
   } else {
-    waittime = zerotime;
-  }
-# ifndef _WIN32
-  rc = select(__glutConnectionFD + 1, &fds,
-    NULL, NULL, &waittime);
-  if (rc < 0 && errno != EINTR) {
-    __glutFatalError("select error.");
+    delta = 0;
   }
-# else
-
+  /* Round the wait up so we never wake just short of the
+     deadline and spin until it arrives. */
   MsgWaitForMultipleObjects(0, NULL, FALSE,
-    waittime.tv_sec*1000 + waittime.tv_usec/1000, QS_ALLINPUT);
-
+    (DWORD) ((delta + 999999) / 1000000), QS_ALLINPUT);
 # endif
 #endif /* not vms6.2 or lower */
-  /* Without considering the cause of select unblocking, check
+checkForInput:
+  /* Without considering the cause of the wait unblocking, check
      for pending X events and handle any timeouts (by calling
      processEventsAndTimeouts).  We always look for X events
-     even if select returned with 0 (indicating a timeout);
+     even if the wait timed out;
      otherwise we risk starving X event processing by continous
      timeouts. */
-  if (XPending(__glutDisplay)) {
+  if (eventsPending()) {
   immediatelyHandleXinput:
     processEventsAndTimeouts();
   } else {
-    if (__glutTimerList) {
-      handleTimeouts();
+    if (__glutTimerCount) {
+      __glutHandleTimeouts();
     }
   }
 }
 
+static int
+idleReady(void)
+{
+  switch (idlePolicy) {
+  case GLUT_IDLE_AFTER_EVENTS:
+    return idleEvents;
+  case GLUT_IDLE_INTERVAL:
+  case GLUT_IDLE_REFRESH:
+    return __glutClockNow() >= idleNext;
+  default:
+    return 1;
+  }
+}
+
+/* When the main loop next has timed work: the earliest timer, or
+   an idle func waiting out its interval. */
+static GLUTnanoseconds
+nextDeadline(void)
+{
+  GLUTnanoseconds deadline = GLUT_WAIT_FOREVER;
+
+  if (__glutIdleFunc && idleInterval) {
+    deadline = idleNext;
+  }
+  if (__glutTimerCount && __glutTimerDeadline() < deadline) {
+    deadline = __glutTimerDeadline();
+  }
+  return deadline;
+}
+
 static void
 idleWait(void)
 {
-  if (XPending(__glutDisplay)) {
+#ifndef _WIN32
+  /* Poll watched descriptors too; the idle func keeps the loop
+     from ever blocking on them. */
+  if (__glutWatchCount) {
+    (void) __glutWaitForEvents(0);
+  }
+#endif
+  if (eventsPending()) {
     processEventsAndTimeouts();
+    idleEvents = 1;
   } else {
-    if (__glutTimerList) {
-      handleTimeouts();
+    if (__glutClockSource == GLUT_CLOCK_VIRTUAL) {
+      GLUTnanoseconds deadline = nextDeadline();
+
+      /* Ready work means the loop never sleeps, so let each pass
+         stand in for a sleep; otherwise virtual time would never
+         reach a timer. */
+      if (deadline != GLUT_WAIT_FOREVER) {
+        __glutAdvanceClockTo(deadline);
+      }
+    }
+    if (__glutTimerCount) {
+      __glutHandleTimeouts();
     }
   }
   /* Make sure idle func still exists! */
-  if (__glutIdleFunc) {
+  if (__glutIdleFunc && idleReady()) {
+    if (idleInterval) {
+      GLUTnanoseconds now = __glutClockNow();
+
+      /* Step from the last slot so the rate holds, unless the
+         loop fell a whole interval behind. */
+      idleNext += idleInterval;
+      if (idleNext <= now) {
+        idleNext = now + idleInterval;
+      }
+    }
+    idleEvents = 0;
     __glutIdleFunc();
   }
 }
 
-static GLUTwindow **beforeEnd;
-
 #ifndef _WIN32
 /* http://standards.freedesktop.org/wm-spec/wm-spec-1.3.html */
 static void setNetWMFullscreen(GLUTwindow *window, int action)
@@ -984,17 +1153,13 @@ static void setNetWMFullscreen(GLUTwindow *window, int action)
 }
 #endif
 
+/* Do the work queued for window, returning the window if more
+   work remains for it or NULL if it can leave the work list. */
 static GLUTwindow *
-processWindowWorkList(GLUTwindow * window)
+processWindowWork(GLUTwindow * window)
 {
   int workMask;
 
-  if (window->prevWorkWin) {
-    window->prevWorkWin = processWindowWorkList(window->prevWorkWin);
-  } else {
-    beforeEnd = &window->prevWorkWin;
-  }
-
   /* Capture work mask for work that needs to be done to this
      window, then clear the window's work mask (excepting the
      dummy work bit, see below).  Then, process the captured
@@ -1012,6 +1177,16 @@ processWindowWorkList(GLUTwindow * window)
      window is on the work list still. */
   window->workMask = GLUT_DUMMY_WORK;
 
+#ifndef _WIN32
+  if (__glutNullWindowSystem) {
+    /* The null window system does configure and map work itself,
+       queuing the events a window system would send back. */
+    __glutNullWindowWork(window, workMask);
+    workMask &= ~(GLUT_EVENT_MASK_WORK | GLUT_DEVICE_MASK_WORK |
+      GLUT_CONFIGURE_WORK | GLUT_COLORMAP_WORK | GLUT_MAP_WORK);
+  }
+#endif
+
   /* Optimization: most of the time, the work to do is a
      redisplay and not these other types of work.  Check for
      the following cases as a group to before checking each one
@@ -1368,9 +1543,6 @@ processWindowWorkList(GLUTwindow * window)
     if (window->workMask) {
       /* Leave on work list. */
       return window;
-    } else {
-      /* Remove current window from work list. */
-      return window->prevWorkWin;
     }
   }
   return NULL;
@@ -1382,17 +1554,32 @@ static  /* X11 implementations do not need this global. */
 void
 __glutProcessWindowWorkLists(void)
 {
-  if (__glutWindowWorkList) {
-    GLUTwindow *remainder, *work;
-
-    work = __glutWindowWorkList;
-    __glutWindowWorkList = NULL;
-    if (work) {
-      remainder = processWindowWorkList(work);
-      if (remainder) {
-        *beforeEnd = __glutWindowWorkList;
-        __glutWindowWorkList = remainder;
-      }
+  GLUTwindow *window, *next;
+
+  /* Take the work list, which is newest first, and reverse it so
+     windows are worked on in the order their work was posted.  A
+     loop rather than recursing down the list keeps the stack
+     shallow however many windows have work.  Windows stay on
+     __glutWindowWorkPending until their turn so that destroying
+     one from another window's callback takes it off. */
+  window = __glutWindowWorkList;
+  __glutWindowWorkList = NULL;
+  while (window) {
+    next = window->prevWorkWin;
+    window->prevWorkWin = __glutWindowWorkPending;
+    __glutWindowWorkPending = window;
+    window = next;
+  }
+  while (__glutWindowWorkPending) {
+    window = __glutWindowWorkPending;
+    __glutWindowWorkPending = window->prevWorkWin;
+    window = processWindowWork(window);
+    if (window) {
+      /* Work remains (or was posted by the callbacks), so put
+         the window back on the work list for the next time
+         through the main loop. */
+      window->prevWorkWin = __glutWindowWorkList;
+      __glutWindowWorkList = window;
     }
   }
 }
@@ -1402,7 +1589,7 @@ void GLUTAPIENTRY
 glutMainLoop(void)
 {
 #ifndef _WIN32
-  if (!__glutDisplay) {
+  if (!__glutDisplay && !__glutNullWindowSystem) {
     __glutFatalUsage("main loop entered with out proper initialization.");
   }
 #endif
@@ -1410,16 +1597,26 @@ glutMainLoop(void)
     __glutFatalUsage(
       "main loop entered with no windows created.");
   }
+  loadStart = __glutClockNow();
+  loadStartCPU = __glutProcessTime();
   for (;;) {
+    if (__glutWakeupPending) {
+      __glutHandleWakeup();
+    }
     __glutProcessWindowWorkLists();
-    if (__glutIdleFunc || __glutWindowWorkList) {
+    if (__glutWindowWorkList || (__glutIdleFunc && idleReady())) {
       idleWait();
     } else {
-      if (__glutTimerList) {
-        waitForSomething();
+      /* An idle func not yet due waits with everything else. */
+      GLUTnanoseconds deadline = nextDeadline();
+
+      if (deadline != GLUT_WAIT_FOREVER) {
+        waitForSomething(deadline);
       } else {
         processEventsAndTimeouts();
       }
+      idleEvents = 1;
+      loopWakeups++;
     }
   }
 }
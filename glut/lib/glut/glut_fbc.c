@@ -166,7 +166,7 @@ __glutGetFCB(int which)
   case GLUT_FCB_SELECT:
     return (void *) __glutCurrentMenu->fselect;
   case GLUT_FCB_TIMER:
-    return (void *) __glutTimerList->ffunc;
+    return (void *) __glutCurrentTimer->ffunc;
   default:
     return NULL;
   }
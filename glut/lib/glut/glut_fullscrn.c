@@ -26,6 +26,9 @@
 #if !defined(_WIN32)
 void __glutMakeFullScreenAtoms()
 {
+  if (__glutNullWindowSystem) {
+    return;
+  }
   if (__glutMotifHints == None) {
     __glutMotifHints = XSGIFastInternAtom(__glutDisplay, "_MOTIF_WM_HINTS",
       SGI_XA__MOTIF_WM_HINTS, 0);
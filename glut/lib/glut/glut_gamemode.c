@@ -57,7 +57,9 @@ glutLeaveGameMode(void)
   }
   __glutDestroyWindow(__glutGameModeWindow,
     __glutGameModeWindow);
-  XFlush(__glutDisplay);
+  if (!__glutNullWindowSystem) {
+    XFlush(__glutDisplay);
+  }
   __glutGameModeWindow = NULL;
 }
 
@@ -633,7 +635,7 @@ glutEnterGameMode(void)
     __glutOpenWin32Connection(NULL);
   }
 #else
-  if (!__glutDisplay) {
+  if (!__glutDisplay && !__glutNullWindowSystem) {
     __glutOpenXConnection(NULL);
   }
 #endif
@@ -692,7 +694,9 @@ glutEnterGameMode(void)
   __glutMakeFullScreenAtoms();
 
   /* Game mode window is a toplevel window. */
-  XSetWMProtocols(__glutDisplay, win, &__glutWMDeleteWindow, 1);
+  if (!__glutNullWindowSystem) {
+    XSetWMProtocols(__glutDisplay, win, &__glutWMDeleteWindow, 1);
+  }
 #endif
 
   /* Schedule the fullscreen property to be added and to
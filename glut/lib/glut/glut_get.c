@@ -6,7 +6,7 @@
    implied. This program is -not- in the public domain. */
 
 #include <assert.h>
-#include <stdlib.h>  /* SunOS 4 needs NULL defined for GETTIMEOFDAY macro. */
+#include <stdlib.h>
 #include "glutint.h"
 
 /* CENTRY */
@@ -17,6 +17,11 @@ glutGet(GLenum param)
   int x, y, value;
   unsigned int width, height, border, depth;
 
+#if !defined(_WIN32)
+  if (__glutNullWindowSystem && __glutNullGet(param, &value)) {
+    return value;
+  }
+#endif
   switch (param) {
   case GLUT_INIT_WINDOW_X:
     return __glutInitX;
@@ -199,33 +204,18 @@ glutGet(GLenum param)
       return 0;
     }
   case GLUT_ELAPSED_TIME:
-    {
-#ifdef _WIN32
-      /* The Unix case below actually would work for Win32, but the
-         Win32 gettimeofday emulation routine has a resolution of about 10
-         millisecond on Windows NT 4.0 and 50 millisecond on Windows 98.
-         So use the higher resolution GetTickCount timer. */
-      DWORD beginning, now;
-
-      beginning = __glutInitTime();
-      /* GetTickCount has 5 millisecond accuracy on Windows 98
-         and 10 millisecond accuracy on Windows NT 4.0. */
-      now = GetTickCount();
-      return (int) (now - beginning);
-#else
-      struct timeval elapsed, beginning, now;
-
-      __glutInitTime(&beginning);
-      GETTIMEOFDAY(&now);
-      TIMEDELTA(elapsed, now, beginning);
-      /* Return elapsed milliseconds. */
-# if defined(__vms) && ( __VMS_VER < 70000000 )
-      return (int) (elapsed.val / TICKS_PER_MILLISECOND);
-# else
-      return (int) ((elapsed.tv_sec * 1000) + (elapsed.tv_usec / 1000));
-# endif
-#endif
-    }
+    /* Return elapsed milliseconds. */
+    return (int) (glutGetNanoseconds() / 1000000);
+  case GLUT_CLOCK_SOURCE:
+    return __glutClockSource;
+  case GLUT_COALESCED_MOTION:
+    return __glutCoalescedMotion;
+  case GLUT_COALESCED_RESHAPE:
+    return __glutCoalescedReshape;
+  case GLUT_CONTEXT_SWITCHES:
+    return __glutContextSwitches;
+  case GLUT_CONTEXT_SWITCHES_AVOIDED:
+    return __glutContextSwitchesAvoided;
   case GLUT_WINDOW_FORMAT_ID:
 #if defined(_WIN32)
     return GetPixelFormat(__glutCurrentWindow->hdc);
@@ -1,1777 +1,624 @@
 
 /* GENERATED FILE -- DO NOT MODIFY */
 
-#define glutBitmapHelvetica10 XXX
-#include "glutbitmap.h"
-#undef glutBitmapHelvetica10
-
-/* char: 0xff */
-
-static const GLubyte ch255data[] = {
-0x80,0x40,0x40,0x60,0xa0,0xa0,0x90,0x90,0x0,0x50,
-};
-
-static const BitmapCharRec ch255 = {4,10,0,2,5,ch255data};
-
-/* char: 0xfe */
-
-static const GLubyte ch254data[] = {
-0x80,0x80,0xb0,0xc8,0x88,0x88,0xc8,0xb0,0x80,0x80,
-};
-
-static const BitmapCharRec ch254 = {5,10,0,2,6,ch254data};
-
-/* char: 0xfd */
-
-static const GLubyte ch253data[] = {
-0x80,0x40,0x40,0x60,0xa0,0xa0,0x90,0x90,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch253 = {4,11,0,2,5,ch253data};
-
-/* char: 0xfc */
-
-static const GLubyte ch252data[] = {
-0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x50,
-};
-
-static const BitmapCharRec ch252 = {4,8,0,0,5,ch252data};
-
-/* char: 0xfb */
-
-static const GLubyte ch251data[] = {
-0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch251 = {4,9,0,0,5,ch251data};
-
-/* char: 0xfa */
-
-static const GLubyte ch250data[] = {
-0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch250 = {4,9,0,0,5,ch250data};
-
-/* char: 0xf9 */
-
-static const GLubyte ch249data[] = {
-0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch249 = {4,9,0,0,5,ch249data};
-
-/* char: 0xf8 */
-
-static const GLubyte ch248data[] = {
-0x70,0x88,0xc8,0xa8,0x98,0x74,
-};
-
-static const BitmapCharRec ch248 = {6,6,0,0,6,ch248data};
-
-/* char: 0xf7 */
-
-static const GLubyte ch247data[] = {
-0x20,0x0,0xf8,0x0,0x20,
-};
-
-static const BitmapCharRec ch247 = {5,5,0,-1,6,ch247data};
-
-/* char: 0xf6 */
-
-static const GLubyte ch246data[] = {
-0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x50,
-};
-
-static const BitmapCharRec ch246 = {5,8,0,0,6,ch246data};
-
-/* char: 0xf5 */
-
-static const GLubyte ch245data[] = {
-0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x50,0x28,
-};
-
-static const BitmapCharRec ch245 = {5,9,0,0,6,ch245data};
-
-/* char: 0xf4 */
-
-static const GLubyte ch244data[] = {
-0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch244 = {5,9,0,0,6,ch244data};
-
-/* char: 0xf3 */
-
-static const GLubyte ch243data[] = {
-0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch243 = {5,9,0,0,6,ch243data};
-
-/* char: 0xf2 */
-
-static const GLubyte ch242data[] = {
-0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch242 = {5,9,0,0,6,ch242data};
-
-/* char: 0xf1 */
-
-static const GLubyte ch241data[] = {
-0x90,0x90,0x90,0x90,0x90,0xe0,0x0,0xa0,0x50,
-};
-
-static const BitmapCharRec ch241 = {4,9,0,0,5,ch241data};
-
-/* char: 0xf0 */
-
-static const GLubyte ch240data[] = {
-0x70,0x88,0x88,0x88,0x88,0x78,0x90,0x60,0x50,
-};
-
-static const BitmapCharRec ch240 = {5,9,0,0,6,ch240data};
-
-/* char: 0xef */
-
-static const GLubyte ch239data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,
-};
-
-static const BitmapCharRec ch239 = {3,8,0,0,2,ch239data};
-
-/* char: 0xee */
-
-static const GLubyte ch238data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch238 = {3,9,1,0,2,ch238data};
-
-/* char: 0xed */
-
-static const GLubyte ch237data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,0x40,
-};
-
-static const BitmapCharRec ch237 = {2,9,0,0,2,ch237data};
-
-/* char: 0xec */
-
-static const GLubyte ch236data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0x0,0x40,0x80,
-};
-
-static const BitmapCharRec ch236 = {2,9,1,0,2,ch236data};
-
-/* char: 0xeb */
-
-static const GLubyte ch235data[] = {
-0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x50,
-};
-
-static const BitmapCharRec ch235 = {4,8,0,0,5,ch235data};
-
-/* char: 0xea */
-
-static const GLubyte ch234data[] = {
-0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch234 = {4,9,0,0,5,ch234data};
-
-/* char: 0xe9 */
-
-static const GLubyte ch233data[] = {
-0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch233 = {4,9,0,0,5,ch233data};
-
-/* char: 0xe8 */
-
-static const GLubyte ch232data[] = {
-0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch232 = {4,9,0,0,5,ch232data};
-
-/* char: 0xe7 */
-
-static const GLubyte ch231data[] = {
-0x60,0x20,0x60,0x90,0x80,0x80,0x90,0x60,
-};
-
-static const BitmapCharRec ch231 = {4,8,0,2,5,ch231data};
-
-/* char: 0xe6 */
-
-static const GLubyte ch230data[] = {
-0x6c,0x92,0x90,0x7e,0x12,0xec,
-};
-
-static const BitmapCharRec ch230 = {7,6,0,0,8,ch230data};
-
-/* char: 0xe5 */
-
-static const GLubyte ch229data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,0x20,0x50,0x20,
-};
-
-static const BitmapCharRec ch229 = {5,9,0,0,5,ch229data};
-
-/* char: 0xe4 */
-
-static const GLubyte ch228data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x50,
-};
-
-static const BitmapCharRec ch228 = {5,8,0,0,5,ch228data};
-
-/* char: 0xe3 */
-
-static const GLubyte ch227data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0xa0,0x50,
-};
-
-static const BitmapCharRec ch227 = {5,9,0,0,5,ch227data};
-
-/* char: 0xe2 */
-
-static const GLubyte ch226data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch226 = {5,9,0,0,5,ch226data};
-
-/* char: 0xe1 */
-
-static const GLubyte ch225data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch225 = {5,9,0,0,5,ch225data};
-
-/* char: 0xe0 */
-
-static const GLubyte ch224data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch224 = {5,9,0,0,5,ch224data};
-
-/* char: 0xdf */
-
-static const GLubyte ch223data[] = {
-0xa0,0x90,0x90,0x90,0xa0,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch223 = {4,8,0,0,5,ch223data};
-
-/* char: 0xde */
-
-static const GLubyte ch222data[] = {
-0x80,0x80,0xf0,0x88,0x88,0xf0,0x80,0x80,
-};
-
-static const BitmapCharRec ch222 = {5,8,-1,0,7,ch222data};
-
-/* char: 0xdd */
-
-static const GLubyte ch221data[] = {
-0x10,0x10,0x10,0x28,0x28,0x44,0x44,0x82,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch221 = {7,11,0,0,7,ch221data};
-
-/* char: 0xdc */
-
-static const GLubyte ch220data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x48,
-};
-
-static const BitmapCharRec ch220 = {6,10,-1,0,8,ch220data};
-
-/* char: 0xdb */
-
-static const GLubyte ch219data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x28,0x10,
-};
-
-static const BitmapCharRec ch219 = {6,11,-1,0,8,ch219data};
-
-/* char: 0xda */
-
-static const GLubyte ch218data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch218 = {6,11,-1,0,8,ch218data};
-
-/* char: 0xd9 */
-
-static const GLubyte ch217data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x10,0x20,
-};
-
-static const BitmapCharRec ch217 = {6,11,-1,0,8,ch217data};
-
-/* char: 0xd8 */
-
-static const GLubyte ch216data[] = {
-0x80,0x78,0xc4,0xa4,0xa4,0x94,0x94,0x8c,0x78,0x4,
-};
-
-static const BitmapCharRec ch216 = {6,10,-1,1,8,ch216data};
-
-/* char: 0xd7 */
-
-static const GLubyte ch215data[] = {
-0x88,0x50,0x20,0x50,0x88,
-};
-
-static const BitmapCharRec ch215 = {5,5,0,-1,6,ch215data};
-
-/* char: 0xd6 */
-
-static const GLubyte ch214data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x48,
-};
-
-static const BitmapCharRec ch214 = {6,10,-1,0,8,ch214data};
-
-/* char: 0xd5 */
-
-static const GLubyte ch213data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x50,0x28,
-};
-
-static const BitmapCharRec ch213 = {6,11,-1,0,8,ch213data};
-
-/* char: 0xd4 */
-
-static const GLubyte ch212data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x28,0x10,
-};
-
-static const BitmapCharRec ch212 = {6,11,-1,0,8,ch212data};
-
-/* char: 0xd3 */
-
-static const GLubyte ch211data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch211 = {6,11,-1,0,8,ch211data};
-
-/* char: 0xd2 */
-
-static const GLubyte ch210data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x10,0x20,
-};
-
-static const BitmapCharRec ch210 = {6,11,-1,0,8,ch210data};
-
-/* char: 0xd1 */
-
-static const GLubyte ch209data[] = {
-0x8c,0x8c,0x94,0x94,0xa4,0xa4,0xc4,0xc4,0x0,0x50,0x28,
-};
-
-static const BitmapCharRec ch209 = {6,11,-1,0,8,ch209data};
-
-/* char: 0xd0 */
-
-static const GLubyte ch208data[] = {
-0x78,0x44,0x42,0x42,0xf2,0x42,0x44,0x78,
-};
-
-static const BitmapCharRec ch208 = {7,8,0,0,8,ch208data};
-
-/* char: 0xcf */
-
-static const GLubyte ch207data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,
-};
-
-static const BitmapCharRec ch207 = {3,10,0,0,3,ch207data};
-
-/* char: 0xce */
-
-static const GLubyte ch206data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch206 = {3,11,0,0,3,ch206data};
-
-/* char: 0xcd */
-
-static const GLubyte ch205data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,0x40,
-};
-
-static const BitmapCharRec ch205 = {2,11,-1,0,3,ch205data};
-
-/* char: 0xcc */
-
-static const GLubyte ch204data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x0,0x40,0x80,
-};
-
-static const BitmapCharRec ch204 = {2,11,0,0,3,ch204data};
-
-/* char: 0xcb */
-
-static const GLubyte ch203data[] = {
-0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,0x0,0x50,
-};
-
-static const BitmapCharRec ch203 = {5,10,-1,0,7,ch203data};
-
-/* char: 0xca */
-
-static const GLubyte ch202data[] = {
-0xf8,0x80,0x80,0xf8,0x80,0x80,0x80,0xf8,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch202 = {5,11,-1,0,7,ch202data};
-
-/* char: 0xc9 */
-
-static const GLubyte ch201data[] = {
-0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch201 = {5,11,-1,0,7,ch201data};
-
-/* char: 0xc8 */
-
-static const GLubyte ch200data[] = {
-0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch200 = {5,11,-1,0,7,ch200data};
-
-/* char: 0xc7 */
-
-static const GLubyte ch199data[] = {
-0x30,0x10,0x78,0x84,0x80,0x80,0x80,0x80,0x84,0x78,
-};
-
-static const BitmapCharRec ch199 = {6,10,-1,2,8,ch199data};
-
-/* char: 0xc6 */
-
-static const GLubyte ch198data[] = {
-0x8f,0x80,0x88,0x0,0x78,0x0,0x48,0x0,0x2f,0x80,0x28,0x0,0x18,0x0,0x1f,0x80,
-};
-
-static const BitmapCharRec ch198 = {9,8,0,0,10,ch198data};
-
-/* char: 0xc5 */
-
-static const GLubyte ch197data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x10,0x28,0x10,
-};
-
-static const BitmapCharRec ch197 = {7,11,0,0,7,ch197data};
-
-/* char: 0xc4 */
-
-static const GLubyte ch196data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x28,
-};
-
-static const BitmapCharRec ch196 = {7,10,0,0,7,ch196data};
-
-/* char: 0xc3 */
-
-static const GLubyte ch195data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x28,0x14,
-};
-
-static const BitmapCharRec ch195 = {7,11,0,0,7,ch195data};
-
-/* char: 0xc2 */
-
-static const GLubyte ch194data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x28,0x10,
-};
-
-static const BitmapCharRec ch194 = {7,11,0,0,7,ch194data};
-
-/* char: 0xc1 */
-
-static const GLubyte ch193data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch193 = {7,11,0,0,7,ch193data};
-
-/* char: 0xc0 */
-
-static const GLubyte ch192data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x10,0x20,
-};
-
-static const BitmapCharRec ch192 = {7,11,0,0,7,ch192data};
-
-/* char: 0xbf */
-
-static const GLubyte ch191data[] = {
-0x60,0x90,0x80,0x40,0x20,0x20,0x0,0x20,
-};
-
-static const BitmapCharRec ch191 = {4,8,-1,2,6,ch191data};
-
-/* char: 0xbe */
-
-static const GLubyte ch190data[] = {
-0x21,0x0,0x17,0x80,0x13,0x0,0x9,0x0,0xc8,0x0,0x24,0x0,0x44,0x0,0xe2,0x0,
-};
-
-static const BitmapCharRec ch190 = {9,8,0,0,9,ch190data};
-
-/* char: 0xbd */
-
-static const GLubyte ch189data[] = {
-0x27,0x12,0x15,0xb,0x48,0x44,0xc4,0x42,
-};
-
-static const BitmapCharRec ch189 = {8,8,0,0,9,ch189data};
-
-/* char: 0xbc */
-
-static const GLubyte ch188data[] = {
-0x21,0x0,0x17,0x80,0x13,0x0,0x9,0x0,0x48,0x0,0x44,0x0,0xc4,0x0,0x42,0x0,
-};
-
-static const BitmapCharRec ch188 = {9,8,0,0,9,ch188data};
-
-/* char: 0xbb */
-
-static const GLubyte ch187data[] = {
-0xa0,0x50,0x28,0x50,0xa0,
-};
-
-static const BitmapCharRec ch187 = {5,5,0,0,6,ch187data};
-
-/* char: 0xba */
-
-static const GLubyte ch186data[] = {
-0xe0,0x0,0xe0,0xa0,0xe0,
-};
-
-static const BitmapCharRec ch186 = {3,5,0,-3,4,ch186data};
-
-/* char: 0xb9 */
-
-static const GLubyte ch185data[] = {
-0x40,0x40,0xc0,0x40,
-};
-
-static const BitmapCharRec ch185 = {2,4,0,-3,3,ch185data};
-
-/* char: 0xb8 */
-
-static const GLubyte ch184data[] = {
-0xc0,0x40,
-};
-
-static const BitmapCharRec ch184 = {2,2,0,2,3,ch184data};
-
-/* char: 0xb7 */
-
-static const GLubyte ch183data[] = {
-0xc0,
-};
-
-static const BitmapCharRec ch183 = {2,1,0,-3,3,ch183data};
-
-/* char: 0xb6 */
-
-static const GLubyte ch182data[] = {
-0x28,0x28,0x28,0x28,0x28,0x68,0xe8,0xe8,0xe8,0x7c,
-};
-
-static const BitmapCharRec ch182 = {6,10,0,2,6,ch182data};
-
-/* char: 0xb5 */
-
-static const GLubyte ch181data[] = {
-0x80,0x80,0xf0,0x90,0x90,0x90,0x90,0x90,
-};
-
-static const BitmapCharRec ch181 = {4,8,0,2,5,ch181data};
-
-/* char: 0xb4 */
-
-static const GLubyte ch180data[] = {
-0x80,0x40,
-};
-
-static const BitmapCharRec ch180 = {2,2,0,-6,3,ch180data};
-
-/* char: 0xb3 */
-
-static const GLubyte ch179data[] = {
-0xc0,0x20,0x40,0xe0,
-};
-
-static const BitmapCharRec ch179 = {3,4,0,-3,3,ch179data};
-
-/* char: 0xb2 */
-
-static const GLubyte ch178data[] = {
-0xe0,0x40,0xa0,0x60,
-};
-
-static const BitmapCharRec ch178 = {3,4,0,-3,3,ch178data};
-
-/* char: 0xb1 */
-
-static const GLubyte ch177data[] = {
-0xf8,0x0,0x20,0x20,0xf8,0x20,0x20,
-};
-
-static const BitmapCharRec ch177 = {5,7,0,0,6,ch177data};
-
-/* char: 0xb0 */
-
-static const GLubyte ch176data[] = {
-0x60,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch176 = {4,4,0,-3,4,ch176data};
-
-/* char: 0xaf */
-
-static const GLubyte ch175data[] = {
-0xe0,
-};
-
-static const BitmapCharRec ch175 = {3,1,0,-7,3,ch175data};
-
-/* char: 0xae */
-
-static const GLubyte ch174data[] = {
-0x38,0x44,0xaa,0xb2,0xba,0x44,0x38,
-};
-
-static const BitmapCharRec ch174 = {7,7,-1,0,9,ch174data};
-
-/* char: 0xad */
-
-static const GLubyte ch173data[] = {
-0xe0,
-};
-
-static const BitmapCharRec ch173 = {3,1,0,-3,4,ch173data};
-
-/* char: 0xac */
-
-static const GLubyte ch172data[] = {
-0x8,0x8,0xf8,
-};
-
-static const BitmapCharRec ch172 = {5,3,-1,-2,7,ch172data};
-
-/* char: 0xab */
-
-static const GLubyte ch171data[] = {
-0x28,0x50,0xa0,0x50,0x28,
-};
-
-static const BitmapCharRec ch171 = {5,5,0,0,6,ch171data};
-
-/* char: 0xaa */
-
-static const GLubyte ch170data[] = {
-0xe0,0x0,0xa0,0x20,0xe0,
-};
-
-static const BitmapCharRec ch170 = {3,5,0,-3,4,ch170data};
-
-/* char: 0xa9 */
-
-static const GLubyte ch169data[] = {
-0x38,0x44,0x9a,0xa2,0x9a,0x44,0x38,
-};
-
-static const BitmapCharRec ch169 = {7,7,-1,0,9,ch169data};
-
-/* char: 0xa8 */
-
-static const GLubyte ch168data[] = {
-0xa0,
-};
-
-static const BitmapCharRec ch168 = {3,1,0,-7,3,ch168data};
-
-/* char: 0xa7 */
-
-static const GLubyte ch167data[] = {
-0x70,0x88,0x18,0x70,0xc8,0x98,0x70,0xc0,0x88,0x70,
-};
-
-static const BitmapCharRec ch167 = {5,10,0,2,6,ch167data};
-
-/* char: 0xa6 */
-
-static const GLubyte ch166data[] = {
-0x80,0x80,0x80,0x80,0x0,0x0,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch166 = {1,10,-1,2,3,ch166data};
-
-/* char: 0xa5 */
-
-static const GLubyte ch165data[] = {
-0x20,0xf8,0x20,0xf8,0x50,0x50,0x88,0x88,
-};
-
-static const BitmapCharRec ch165 = {5,8,0,0,6,ch165data};
-
-/* char: 0xa4 */
-
-static const GLubyte ch164data[] = {
-0x90,0x60,0x90,0x90,0x60,0x90,
-};
-
-static const BitmapCharRec ch164 = {4,6,0,-1,5,ch164data};
-
-/* char: 0xa3 */
-
-static const GLubyte ch163data[] = {
-0xb0,0x48,0x40,0x40,0xe0,0x40,0x48,0x30,
-};
-
-static const BitmapCharRec ch163 = {5,8,0,0,6,ch163data};
-
-/* char: 0xa2 */
-
-static const GLubyte ch162data[] = {
-0x40,0x70,0xa8,0xa0,0xa0,0xa8,0x70,0x10,
-};
-
-static const BitmapCharRec ch162 = {5,8,0,1,6,ch162data};
-
-/* char: 0xa1 */
-
-static const GLubyte ch161data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,
-};
-
-static const BitmapCharRec ch161 = {1,8,-1,2,3,ch161data};
-
-/* char: 0xa0 */
-
-#ifdef _WIN32
-/* XXX Work around Microsoft OpenGL 1.1 bug where glBitmap with
-   a height or width of zero does not advance the raster position
-   as specified by OpenGL. (Cosmo OpenGL does not have this bug.) */
-static const GLubyte ch160data[] = { 0x0 };
-static const BitmapCharRec ch160 = {1,1,0,0,3,ch160data};
-#else
-static const BitmapCharRec ch160 = {0,0,0,0,3,0};
-#endif
-
-/* char: 0x7e '~' */
-
-static const GLubyte ch126data[] = {
-0x98,0x64,
-};
-
-static const BitmapCharRec ch126 = {6,2,0,-3,7,ch126data};
-
-/* char: 0x7d '}' */
-
-static const GLubyte ch125data[] = {
-0x80,0x40,0x40,0x40,0x40,0x20,0x40,0x40,0x40,0x80,
-};
-
-static const BitmapCharRec ch125 = {3,10,0,2,3,ch125data};
-
-/* char: 0x7c '|' */
-
-static const GLubyte ch124data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch124 = {1,10,-1,2,3,ch124data};
-
-/* char: 0x7b '{' */
-
-static const GLubyte ch123data[] = {
-0x20,0x40,0x40,0x40,0x40,0x80,0x40,0x40,0x40,0x20,
-};
-
-static const BitmapCharRec ch123 = {3,10,0,2,3,ch123data};
-
-/* char: 0x7a 'z' */
-
-static const GLubyte ch122data[] = {
-0xf0,0x80,0x40,0x20,0x10,0xf0,
-};
-
-static const BitmapCharRec ch122 = {4,6,0,0,5,ch122data};
-
-/* char: 0x79 'y' */
-
-static const GLubyte ch121data[] = {
-0x80,0x40,0x40,0x60,0xa0,0xa0,0x90,0x90,
-};
-
-static const BitmapCharRec ch121 = {4,8,0,2,5,ch121data};
-
-/* char: 0x78 'x' */
-
-static const GLubyte ch120data[] = {
-0x88,0x88,0x50,0x20,0x50,0x88,
-};
-
-static const BitmapCharRec ch120 = {5,6,0,0,6,ch120data};
-
-/* char: 0x77 'w' */
-
-static const GLubyte ch119data[] = {
-0x28,0x28,0x54,0x54,0x92,0x92,
-};
-
-static const BitmapCharRec ch119 = {7,6,0,0,8,ch119data};
-
-/* char: 0x76 'v' */
-
-static const GLubyte ch118data[] = {
-0x20,0x20,0x50,0x50,0x88,0x88,
-};
-
-static const BitmapCharRec ch118 = {5,6,0,0,6,ch118data};
-
-/* char: 0x75 'u' */
-
-static const GLubyte ch117data[] = {
-0x70,0x90,0x90,0x90,0x90,0x90,
-};
-
-static const BitmapCharRec ch117 = {4,6,0,0,5,ch117data};
-
-/* char: 0x74 't' */
-
-static const GLubyte ch116data[] = {
-0x60,0x40,0x40,0x40,0x40,0xe0,0x40,0x40,
-};
-
-static const BitmapCharRec ch116 = {3,8,0,0,4,ch116data};
-
-/* char: 0x73 's' */
-
-static const GLubyte ch115data[] = {
-0x60,0x90,0x10,0x60,0x90,0x60,
-};
-
-static const BitmapCharRec ch115 = {4,6,0,0,5,ch115data};
-
-/* char: 0x72 'r' */
-
-static const GLubyte ch114data[] = {
-0x80,0x80,0x80,0x80,0xc0,0xa0,
-};
-
-static const BitmapCharRec ch114 = {3,6,0,0,4,ch114data};
-
-/* char: 0x71 'q' */
-
-static const GLubyte ch113data[] = {
-0x8,0x8,0x68,0x98,0x88,0x88,0x98,0x68,
-};
-
-static const BitmapCharRec ch113 = {5,8,0,2,6,ch113data};
-
-/* char: 0x70 'p' */
-
-static const GLubyte ch112data[] = {
-0x80,0x80,0xb0,0xc8,0x88,0x88,0xc8,0xb0,
-};
-
-static const BitmapCharRec ch112 = {5,8,0,2,6,ch112data};
-
-/* char: 0x6f 'o' */
-
-static const GLubyte ch111data[] = {
-0x70,0x88,0x88,0x88,0x88,0x70,
-};
-
-static const BitmapCharRec ch111 = {5,6,0,0,6,ch111data};
-
-/* char: 0x6e 'n' */
-
-static const GLubyte ch110data[] = {
-0x88,0x88,0x88,0x88,0xc8,0xb0,
-};
-
-static const BitmapCharRec ch110 = {5,6,0,0,6,ch110data};
-
-/* char: 0x6d 'm' */
-
-static const GLubyte ch109data[] = {
-0x92,0x92,0x92,0x92,0x92,0xec,
-};
-
-static const BitmapCharRec ch109 = {7,6,0,0,8,ch109data};
-
-/* char: 0x6c 'l' */
-
-static const GLubyte ch108data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch108 = {1,8,0,0,2,ch108data};
-
-/* char: 0x6b 'k' */
-
-static const GLubyte ch107data[] = {
-0x90,0x90,0xa0,0xc0,0xa0,0x90,0x80,0x80,
-};
-
-static const BitmapCharRec ch107 = {4,8,0,0,5,ch107data};
-
-/* char: 0x6a 'j' */
-
-static const GLubyte ch106data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,
-};
-
-static const BitmapCharRec ch106 = {1,9,0,1,2,ch106data};
-
-/* char: 0x69 'i' */
-
-static const GLubyte ch105data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,
-};
-
-static const BitmapCharRec ch105 = {1,8,0,0,2,ch105data};
-
-/* char: 0x68 'h' */
-
-static const GLubyte ch104data[] = {
-0x88,0x88,0x88,0x88,0xc8,0xb0,0x80,0x80,
-};
-
-static const BitmapCharRec ch104 = {5,8,0,0,6,ch104data};
-
-/* char: 0x67 'g' */
-
-static const GLubyte ch103data[] = {
-0x70,0x8,0x68,0x98,0x88,0x88,0x98,0x68,
-};
-
-static const BitmapCharRec ch103 = {5,8,0,2,6,ch103data};
-
-/* char: 0x66 'f' */
-
-static const GLubyte ch102data[] = {
-0x40,0x40,0x40,0x40,0x40,0xe0,0x40,0x30,
-};
-
-static const BitmapCharRec ch102 = {4,8,0,0,4,ch102data};
-
-/* char: 0x65 'e' */
-
-static const GLubyte ch101data[] = {
-0x60,0x90,0x80,0xf0,0x90,0x60,
-};
-
-static const BitmapCharRec ch101 = {4,6,0,0,5,ch101data};
-
-/* char: 0x64 'd' */
-
-static const GLubyte ch100data[] = {
-0x68,0x98,0x88,0x88,0x98,0x68,0x8,0x8,
-};
-
-static const BitmapCharRec ch100 = {5,8,0,0,6,ch100data};
-
-/* char: 0x63 'c' */
-
-static const GLubyte ch99data[] = {
-0x60,0x90,0x80,0x80,0x90,0x60,
-};
-
-static const BitmapCharRec ch99 = {4,6,0,0,5,ch99data};
-
-/* char: 0x62 'b' */
-
-static const GLubyte ch98data[] = {
-0xb0,0xc8,0x88,0x88,0xc8,0xb0,0x80,0x80,
-};
-
-static const BitmapCharRec ch98 = {5,8,0,0,6,ch98data};
-
-/* char: 0x61 'a' */
-
-static const GLubyte ch97data[] = {
-0x68,0x90,0x90,0x70,0x10,0xe0,
-};
-
-static const BitmapCharRec ch97 = {5,6,0,0,5,ch97data};
-
-/* char: 0x60 '`' */
-
-static const GLubyte ch96data[] = {
-0x80,0x80,0x40,
-};
-
-static const BitmapCharRec ch96 = {2,3,0,-5,3,ch96data};
-
-/* char: 0x5f '_' */
-
-static const GLubyte ch95data[] = {
-0xfc,
-};
-
-static const BitmapCharRec ch95 = {6,1,0,2,6,ch95data};
-
-/* char: 0x5e '^' */
-
-static const GLubyte ch94data[] = {
-0x88,0x50,0x50,0x20,0x20,
-};
-
-static const BitmapCharRec ch94 = {5,5,0,-3,6,ch94data};
-
-/* char: 0x5d ']' */
-
-static const GLubyte ch93data[] = {
-0xc0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0xc0,
-};
-
-static const BitmapCharRec ch93 = {2,10,0,2,3,ch93data};
-
-/* char: 0x5c '\' */
-
-static const GLubyte ch92data[] = {
-0x20,0x20,0x40,0x40,0x40,0x40,0x80,0x80,
-};
-
-static const BitmapCharRec ch92 = {3,8,0,0,3,ch92data};
-
-/* char: 0x5b '[' */
-
-static const GLubyte ch91data[] = {
-0xc0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xc0,
-};
-
-static const BitmapCharRec ch91 = {2,10,-1,2,3,ch91data};
-
-/* char: 0x5a 'Z' */
-
-static const GLubyte ch90data[] = {
-0xf8,0x80,0x40,0x20,0x20,0x10,0x8,0xf8,
-};
-
-static const BitmapCharRec ch90 = {5,8,-1,0,7,ch90data};
-
-/* char: 0x59 'Y' */
-
-static const GLubyte ch89data[] = {
-0x10,0x10,0x10,0x28,0x28,0x44,0x44,0x82,
-};
-
-static const BitmapCharRec ch89 = {7,8,0,0,7,ch89data};
-
-/* char: 0x58 'X' */
-
-static const GLubyte ch88data[] = {
-0x88,0x88,0x50,0x50,0x20,0x50,0x88,0x88,
-};
-
-static const BitmapCharRec ch88 = {5,8,-1,0,7,ch88data};
-
-/* char: 0x57 'W' */
-
-static const GLubyte ch87data[] = {
-0x22,0x0,0x22,0x0,0x22,0x0,0x55,0x0,0x49,0x0,0x49,0x0,0x88,0x80,0x88,0x80,
-};
-
-static const BitmapCharRec ch87 = {9,8,0,0,9,ch87data};
-
-/* char: 0x56 'V' */
-
-static const GLubyte ch86data[] = {
-0x10,0x28,0x28,0x44,0x44,0x44,0x82,0x82,
-};
-
-static const BitmapCharRec ch86 = {7,8,0,0,7,ch86data};
-
-/* char: 0x55 'U' */
-
-static const GLubyte ch85data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,
-};
-
-static const BitmapCharRec ch85 = {6,8,-1,0,8,ch85data};
-
-/* char: 0x54 'T' */
-
-static const GLubyte ch84data[] = {
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xf8,
-};
-
-static const BitmapCharRec ch84 = {5,8,0,0,5,ch84data};
-
-/* char: 0x53 'S' */
-
-static const GLubyte ch83data[] = {
-0x70,0x88,0x88,0x8,0x70,0x80,0x88,0x70,
-};
-
-static const BitmapCharRec ch83 = {5,8,-1,0,7,ch83data};
-
-/* char: 0x52 'R' */
-
-static const GLubyte ch82data[] = {
-0x88,0x88,0x88,0x88,0xf0,0x88,0x88,0xf0,
-};
-
-static const BitmapCharRec ch82 = {5,8,-1,0,7,ch82data};
-
-/* char: 0x51 'Q' */
-
-static const GLubyte ch81data[] = {
-0x2,0x7c,0x8c,0x94,0x84,0x84,0x84,0x84,0x78,
-};
-
-static const BitmapCharRec ch81 = {7,9,-1,1,8,ch81data};
-
-/* char: 0x50 'P' */
-
-static const GLubyte ch80data[] = {
-0x80,0x80,0x80,0x80,0xf0,0x88,0x88,0xf0,
-};
-
-static const BitmapCharRec ch80 = {5,8,-1,0,7,ch80data};
-
-/* char: 0x4f 'O' */
-
-static const GLubyte ch79data[] = {
-0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,
-};
-
-static const BitmapCharRec ch79 = {6,8,-1,0,8,ch79data};
-
-/* char: 0x4e 'N' */
-
-static const GLubyte ch78data[] = {
-0x8c,0x8c,0x94,0x94,0xa4,0xa4,0xc4,0xc4,
-};
-
-static const BitmapCharRec ch78 = {6,8,-1,0,8,ch78data};
-
-/* char: 0x4d 'M' */
-
-static const GLubyte ch77data[] = {
-0x92,0x92,0x92,0xaa,0xaa,0xc6,0xc6,0x82,
-};
-
-static const BitmapCharRec ch77 = {7,8,-1,0,9,ch77data};
-
-/* char: 0x4c 'L' */
-
-static const GLubyte ch76data[] = {
-0xf0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch76 = {4,8,-1,0,6,ch76data};
-
-/* char: 0x4b 'K' */
-
-static const GLubyte ch75data[] = {
-0x88,0x88,0x90,0x90,0xe0,0xa0,0x90,0x88,
-};
-
-static const BitmapCharRec ch75 = {5,8,-1,0,7,ch75data};
-
-/* char: 0x4a 'J' */
-
-static const GLubyte ch74data[] = {
-0x60,0x90,0x10,0x10,0x10,0x10,0x10,0x10,
-};
-
-static const BitmapCharRec ch74 = {4,8,0,0,5,ch74data};
-
-/* char: 0x49 'I' */
-
-static const GLubyte ch73data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch73 = {1,8,-1,0,3,ch73data};
-
-/* char: 0x48 'H' */
-
-static const GLubyte ch72data[] = {
-0x84,0x84,0x84,0x84,0xfc,0x84,0x84,0x84,
-};
-
-static const BitmapCharRec ch72 = {6,8,-1,0,8,ch72data};
-
-/* char: 0x47 'G' */
-
-static const GLubyte ch71data[] = {
-0x74,0x8c,0x84,0x8c,0x80,0x80,0x84,0x78,
-};
-
-static const BitmapCharRec ch71 = {6,8,-1,0,8,ch71data};
-
-/* char: 0x46 'F' */
-
-static const GLubyte ch70data[] = {
-0x80,0x80,0x80,0x80,0xf0,0x80,0x80,0xf8,
-};
-
-static const BitmapCharRec ch70 = {5,8,-1,0,6,ch70data};
-
-/* char: 0x45 'E' */
-
-static const GLubyte ch69data[] = {
-0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,
-};
-
-static const BitmapCharRec ch69 = {5,8,-1,0,7,ch69data};
-
-/* char: 0x44 'D' */
-
-static const GLubyte ch68data[] = {
-0xf0,0x88,0x84,0x84,0x84,0x84,0x88,0xf0,
-};
-
-static const BitmapCharRec ch68 = {6,8,-1,0,8,ch68data};
-
-/* char: 0x43 'C' */
-
-static const GLubyte ch67data[] = {
-0x78,0x84,0x80,0x80,0x80,0x80,0x84,0x78,
-};
-
-static const BitmapCharRec ch67 = {6,8,-1,0,8,ch67data};
-
-/* char: 0x42 'B' */
-
-static const GLubyte ch66data[] = {
-0xf0,0x88,0x88,0x88,0xf0,0x88,0x88,0xf0,
-};
-
-static const BitmapCharRec ch66 = {5,8,-1,0,7,ch66data};
-
-/* char: 0x41 'A' */
-
-static const GLubyte ch65data[] = {
-0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,
-};
-
-static const BitmapCharRec ch65 = {7,8,0,0,7,ch65data};
-
-/* char: 0x40 '@' */
-
-static const GLubyte ch64data[] = {
-0x3e,0x0,0x40,0x0,0x9b,0x0,0xa4,0x80,0xa4,0x80,0xa2,0x40,0x92,0x40,0x4d,0x40,
-0x20,0x80,0x1f,0x0,
-};
-
-static const BitmapCharRec ch64 = {10,10,0,2,11,ch64data};
-
-/* char: 0x3f '?' */
-
-static const GLubyte ch63data[] = {
-0x40,0x0,0x40,0x40,0x20,0x10,0x90,0x60,
-};
-
-static const BitmapCharRec ch63 = {4,8,-1,0,6,ch63data};
-
-/* char: 0x3e '>' */
-
-static const GLubyte ch62data[] = {
-0x80,0x40,0x20,0x40,0x80,
-};
-
-static const BitmapCharRec ch62 = {3,5,-1,-1,6,ch62data};
-
-/* char: 0x3d '=' */
-
-static const GLubyte ch61data[] = {
-0xf0,0x0,0xf0,
-};
-
-static const BitmapCharRec ch61 = {4,3,0,-2,5,ch61data};
-
-/* char: 0x3c '<' */
-
-static const GLubyte ch60data[] = {
-0x20,0x40,0x80,0x40,0x20,
-};
-
-static const BitmapCharRec ch60 = {3,5,-1,-1,6,ch60data};
-
-/* char: 0x3b ';' */
-
-static const GLubyte ch59data[] = {
-0x80,0x40,0x40,0x0,0x0,0x0,0x0,0x40,
-};
-
-static const BitmapCharRec ch59 = {2,8,0,2,3,ch59data};
-
-/* char: 0x3a ':' */
-
-static const GLubyte ch58data[] = {
-0x80,0x0,0x0,0x0,0x0,0x80,
-};
-
-static const BitmapCharRec ch58 = {1,6,-1,0,3,ch58data};
-
-/* char: 0x39 '9' */
-
-static const GLubyte ch57data[] = {
-0x70,0x88,0x8,0x68,0x98,0x88,0x88,0x70,
-};
-
-static const BitmapCharRec ch57 = {5,8,0,0,6,ch57data};
-
-/* char: 0x38 '8' */
-
-static const GLubyte ch56data[] = {
-0x70,0x88,0x88,0x88,0x70,0x88,0x88,0x70,
-};
-
-static const BitmapCharRec ch56 = {5,8,0,0,6,ch56data};
+/* X font: -adobe-helvetica-medium-r-normal--10-100-75-75-p-56-iso8859-1 */
 
-/* char: 0x37 '7' */
-
-static const GLubyte ch55data[] = {
-0x40,0x40,0x20,0x20,0x10,0x10,0x8,0xf8,
-};
-
-static const BitmapCharRec ch55 = {5,8,0,0,6,ch55data};
-
-/* char: 0x36 '6' */
-
-static const GLubyte ch54data[] = {
-0x70,0x88,0x88,0xc8,0xb0,0x80,0x88,0x70,
-};
-
-static const BitmapCharRec ch54 = {5,8,0,0,6,ch54data};
-
-/* char: 0x35 '5' */
-
-static const GLubyte ch53data[] = {
-0x70,0x88,0x8,0x8,0xf0,0x80,0x80,0xf8,
-};
-
-static const BitmapCharRec ch53 = {5,8,0,0,6,ch53data};
-
-/* char: 0x34 '4' */
-
-static const GLubyte ch52data[] = {
-0x10,0x10,0xf8,0x90,0x50,0x50,0x30,0x10,
-};
-
-static const BitmapCharRec ch52 = {5,8,0,0,6,ch52data};
-
-/* char: 0x33 '3' */
-
-static const GLubyte ch51data[] = {
-0x70,0x88,0x8,0x8,0x30,0x8,0x88,0x70,
-};
-
-static const BitmapCharRec ch51 = {5,8,0,0,6,ch51data};
-
-/* char: 0x32 '2' */
-
-static const GLubyte ch50data[] = {
-0xf8,0x80,0x40,0x30,0x8,0x8,0x88,0x70,
-};
-
-static const BitmapCharRec ch50 = {5,8,0,0,6,ch50data};
-
-/* char: 0x31 '1' */
-
-static const GLubyte ch49data[] = {
-0x40,0x40,0x40,0x40,0x40,0x40,0xc0,0x40,
-};
-
-static const BitmapCharRec ch49 = {2,8,-1,0,6,ch49data};
-
-/* char: 0x30 '0' */
-
-static const GLubyte ch48data[] = {
-0x70,0x88,0x88,0x88,0x88,0x88,0x88,0x70,
-};
-
-static const BitmapCharRec ch48 = {5,8,0,0,6,ch48data};
-
-/* char: 0x2f '/' */
-
-static const GLubyte ch47data[] = {
-0x80,0x80,0x40,0x40,0x40,0x40,0x20,0x20,
-};
-
-static const BitmapCharRec ch47 = {3,8,0,0,3,ch47data};
-
-/* char: 0x2e '.' */
-
-static const GLubyte ch46data[] = {
-0x80,
-};
-
-static const BitmapCharRec ch46 = {1,1,-1,0,3,ch46data};
-
-/* char: 0x2d '-' */
-
-static const GLubyte ch45data[] = {
-0xf8,
-};
-
-static const BitmapCharRec ch45 = {5,1,-1,-3,7,ch45data};
-
-/* char: 0x2c ',' */
+#define glutBitmapHelvetica10 XXX
+#include "glutbitmap.h"
+#undef glutBitmapHelvetica10
 
-static const GLubyte ch44data[] = {
+static const GLubyte bitmaps[] = {
+/* char: 0x21 '!' */
+0x80,0x0,0x80,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x22 '"' */
+0xa0,0xa0,
+/* char: 0x23 '#' */
+0x50,0x50,0xf8,0x28,0x7c,0x28,0x28,
+/* char: 0x24 '$' */
+0x20,0x70,0xa8,0x28,0x70,0xa0,0xa8,0x70,0x20,
+/* char: 0x25 '%' */
+0x26,0x29,0x16,0x10,0x8,0x68,0x94,0x64,
+/* char: 0x26 '&' */
+0x64,0x98,0x98,0xa4,0x60,0x50,0x50,0x20,
+/* char: 0x27 ''' */
 0x80,0x40,0x40,
-};
-
-static const BitmapCharRec ch44 = {2,3,0,2,3,ch44data};
-
-/* char: 0x2b '+' */
-
-static const GLubyte ch43data[] = {
-0x20,0x20,0xf8,0x20,0x20,
-};
-
-static const BitmapCharRec ch43 = {5,5,0,-1,6,ch43data};
-
-/* char: 0x2a '*' */
-
-static const GLubyte ch42data[] = {
-0xa0,0x40,0xa0,
-};
-
-static const BitmapCharRec ch42 = {3,3,0,-5,4,ch42data};
-
-/* char: 0x29 ')' */
-
-static const GLubyte ch41data[] = {
-0x80,0x40,0x40,0x20,0x20,0x20,0x20,0x40,0x40,0x80,
-};
-
-static const BitmapCharRec ch41 = {3,10,-1,2,4,ch41data};
-
 /* char: 0x28 '(' */
-
-static const GLubyte ch40data[] = {
 0x20,0x40,0x40,0x80,0x80,0x80,0x80,0x40,0x40,0x20,
-};
-
-static const BitmapCharRec ch40 = {3,10,0,2,4,ch40data};
-
-/* char: 0x27 ''' */
-
-static const GLubyte ch39data[] = {
+/* char: 0x29 ')' */
+0x80,0x40,0x40,0x20,0x20,0x20,0x20,0x40,0x40,0x80,
+/* char: 0x2a '*' */
+0xa0,0x40,0xa0,
+/* char: 0x2b '+' */
+0x20,0x20,0xf8,0x20,0x20,
+/* char: 0x2c ',' */
 0x80,0x40,0x40,
+/* char: 0x2d '-' */
+0xf8,
+/* char: 0x2e '.' */
+0x80,
+/* char: 0x2f '/' */
+0x80,0x80,0x40,0x40,0x40,0x40,0x20,0x20,
+/* char: 0x30 '0' */
+0x70,0x88,0x88,0x88,0x88,0x88,0x88,0x70,
+/* char: 0x31 '1' */
+0x40,0x40,0x40,0x40,0x40,0x40,0xc0,0x40,
+/* char: 0x32 '2' */
+0xf8,0x80,0x40,0x30,0x8,0x8,0x88,0x70,
+/* char: 0x33 '3' */
+0x70,0x88,0x8,0x8,0x30,0x8,0x88,0x70,
+/* char: 0x34 '4' */
+0x10,0x10,0xf8,0x90,0x50,0x50,0x30,0x10,
+/* char: 0x35 '5' */
+0x70,0x88,0x8,0x8,0xf0,0x80,0x80,0xf8,
+/* char: 0x36 '6' */
+0x70,0x88,0x88,0xc8,0xb0,0x80,0x88,0x70,
+/* char: 0x37 '7' */
+0x40,0x40,0x20,0x20,0x10,0x10,0x8,0xf8,
+/* char: 0x38 '8' */
+0x70,0x88,0x88,0x88,0x70,0x88,0x88,0x70,
+/* char: 0x39 '9' */
+0x70,0x88,0x8,0x68,0x98,0x88,0x88,0x70,
+/* char: 0x3a ':' */
+0x80,0x0,0x0,0x0,0x0,0x80,
+/* char: 0x3b ';' */
+0x80,0x40,0x40,0x0,0x0,0x0,0x0,0x40,
+/* char: 0x3c '<' */
+0x20,0x40,0x80,0x40,0x20,
+/* char: 0x3d '=' */
+0xf0,0x0,0xf0,
+/* char: 0x3e '>' */
+0x80,0x40,0x20,0x40,0x80,
+/* char: 0x3f '?' */
+0x40,0x0,0x40,0x40,0x20,0x10,0x90,0x60,
+/* char: 0x40 '@' */
+0x3e,0x0,0x40,0x0,0x9b,0x0,0xa4,0x80,0xa4,0x80,0xa2,0x40,0x92,0x40,0x4d,0x40,
+0x20,0x80,0x1f,0x0,
+/* char: 0x41 'A' */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,
+/* char: 0x42 'B' */
+0xf0,0x88,0x88,0x88,0xf0,0x88,0x88,0xf0,
+/* char: 0x43 'C' */
+0x78,0x84,0x80,0x80,0x80,0x80,0x84,0x78,
+/* char: 0x44 'D' */
+0xf0,0x88,0x84,0x84,0x84,0x84,0x88,0xf0,
+/* char: 0x45 'E' */
+0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,
+/* char: 0x46 'F' */
+0x80,0x80,0x80,0x80,0xf0,0x80,0x80,0xf8,
+/* char: 0x47 'G' */
+0x74,0x8c,0x84,0x8c,0x80,0x80,0x84,0x78,
+/* char: 0x48 'H' */
+0x84,0x84,0x84,0x84,0xfc,0x84,0x84,0x84,
+/* char: 0x49 'I' */
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x4a 'J' */
+0x60,0x90,0x10,0x10,0x10,0x10,0x10,0x10,
+/* char: 0x4b 'K' */
+0x88,0x88,0x90,0x90,0xe0,0xa0,0x90,0x88,
+/* char: 0x4c 'L' */
+0xf0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x4d 'M' */
+0x92,0x92,0x92,0xaa,0xaa,0xc6,0xc6,0x82,
+/* char: 0x4e 'N' */
+0x8c,0x8c,0x94,0x94,0xa4,0xa4,0xc4,0xc4,
+/* char: 0x4f 'O' */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,
+/* char: 0x50 'P' */
+0x80,0x80,0x80,0x80,0xf0,0x88,0x88,0xf0,
+/* char: 0x51 'Q' */
+0x2,0x7c,0x8c,0x94,0x84,0x84,0x84,0x84,0x78,
+/* char: 0x52 'R' */
+0x88,0x88,0x88,0x88,0xf0,0x88,0x88,0xf0,
+/* char: 0x53 'S' */
+0x70,0x88,0x88,0x8,0x70,0x80,0x88,0x70,
+/* char: 0x54 'T' */
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xf8,
+/* char: 0x55 'U' */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,
+/* char: 0x56 'V' */
+0x10,0x28,0x28,0x44,0x44,0x44,0x82,0x82,
+/* char: 0x57 'W' */
+0x22,0x0,0x22,0x0,0x22,0x0,0x55,0x0,0x49,0x0,0x49,0x0,0x88,0x80,0x88,0x80,
+/* char: 0x58 'X' */
+0x88,0x88,0x50,0x50,0x20,0x50,0x88,0x88,
+/* char: 0x59 'Y' */
+0x10,0x10,0x10,0x28,0x28,0x44,0x44,0x82,
+/* char: 0x5a 'Z' */
+0xf8,0x80,0x40,0x20,0x20,0x10,0x8,0xf8,
+/* char: 0x5b '[' */
+0xc0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xc0,
+/* char: 0x5c '\' */
+0x20,0x20,0x40,0x40,0x40,0x40,0x80,0x80,
+/* char: 0x5d ']' */
+0xc0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0xc0,
+/* char: 0x5e '^' */
+0x88,0x50,0x50,0x20,0x20,
+/* char: 0x5f '_' */
+0xfc,
+/* char: 0x60 '`' */
+0x80,0x80,0x40,
+/* char: 0x61 'a' */
+0x68,0x90,0x90,0x70,0x10,0xe0,
+/* char: 0x62 'b' */
+0xb0,0xc8,0x88,0x88,0xc8,0xb0,0x80,0x80,
+/* char: 0x63 'c' */
+0x60,0x90,0x80,0x80,0x90,0x60,
+/* char: 0x64 'd' */
+0x68,0x98,0x88,0x88,0x98,0x68,0x8,0x8,
+/* char: 0x65 'e' */
+0x60,0x90,0x80,0xf0,0x90,0x60,
+/* char: 0x66 'f' */
+0x40,0x40,0x40,0x40,0x40,0xe0,0x40,0x30,
+/* char: 0x67 'g' */
+0x70,0x8,0x68,0x98,0x88,0x88,0x98,0x68,
+/* char: 0x68 'h' */
+0x88,0x88,0x88,0x88,0xc8,0xb0,0x80,0x80,
+/* char: 0x69 'i' */
+0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,
+/* char: 0x6a 'j' */
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,
+/* char: 0x6b 'k' */
+0x90,0x90,0xa0,0xc0,0xa0,0x90,0x80,0x80,
+/* char: 0x6c 'l' */
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x6d 'm' */
+0x92,0x92,0x92,0x92,0x92,0xec,
+/* char: 0x6e 'n' */
+0x88,0x88,0x88,0x88,0xc8,0xb0,
+/* char: 0x6f 'o' */
+0x70,0x88,0x88,0x88,0x88,0x70,
+/* char: 0x70 'p' */
+0x80,0x80,0xb0,0xc8,0x88,0x88,0xc8,0xb0,
+/* char: 0x71 'q' */
+0x8,0x8,0x68,0x98,0x88,0x88,0x98,0x68,
+/* char: 0x72 'r' */
+0x80,0x80,0x80,0x80,0xc0,0xa0,
+/* char: 0x73 's' */
+0x60,0x90,0x10,0x60,0x90,0x60,
+/* char: 0x74 't' */
+0x60,0x40,0x40,0x40,0x40,0xe0,0x40,0x40,
+/* char: 0x75 'u' */
+0x70,0x90,0x90,0x90,0x90,0x90,
+/* char: 0x76 'v' */
+0x20,0x20,0x50,0x50,0x88,0x88,
+/* char: 0x77 'w' */
+0x28,0x28,0x54,0x54,0x92,0x92,
+/* char: 0x78 'x' */
+0x88,0x88,0x50,0x20,0x50,0x88,
+/* char: 0x79 'y' */
+0x80,0x40,0x40,0x60,0xa0,0xa0,0x90,0x90,
+/* char: 0x7a 'z' */
+0xf0,0x80,0x40,0x20,0x10,0xf0,
+/* char: 0x7b '{' */
+0x20,0x40,0x40,0x40,0x40,0x80,0x40,0x40,0x40,0x20,
+/* char: 0x7c '|' */
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x7d '}' */
+0x80,0x40,0x40,0x40,0x40,0x20,0x40,0x40,0x40,0x80,
+/* char: 0x7e '~' */
+0x98,0x64,
+/* char: 0xa1 */
+0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,
+/* char: 0xa2 */
+0x40,0x70,0xa8,0xa0,0xa0,0xa8,0x70,0x10,
+/* char: 0xa3 */
+0xb0,0x48,0x40,0x40,0xe0,0x40,0x48,0x30,
+/* char: 0xa4 */
+0x90,0x60,0x90,0x90,0x60,0x90,
+/* char: 0xa5 */
+0x20,0xf8,0x20,0xf8,0x50,0x50,0x88,0x88,
+/* char: 0xa6 */
+0x80,0x80,0x80,0x80,0x0,0x0,0x80,0x80,0x80,0x80,
+/* char: 0xa7 */
+0x70,0x88,0x18,0x70,0xc8,0x98,0x70,0xc0,0x88,0x70,
+/* char: 0xa8 */
+0xa0,
+/* char: 0xa9 */
+0x38,0x44,0x9a,0xa2,0x9a,0x44,0x38,
+/* char: 0xaa */
+0xe0,0x0,0xa0,0x20,0xe0,
+/* char: 0xab */
+0x28,0x50,0xa0,0x50,0x28,
+/* char: 0xac */
+0x8,0x8,0xf8,
+/* char: 0xad */
+0xe0,
+/* char: 0xae */
+0x38,0x44,0xaa,0xb2,0xba,0x44,0x38,
+/* char: 0xaf */
+0xe0,
+/* char: 0xb0 */
+0x60,0x90,0x90,0x60,
+/* char: 0xb1 */
+0xf8,0x0,0x20,0x20,0xf8,0x20,0x20,
+/* char: 0xb2 */
+0xe0,0x40,0xa0,0x60,
+/* char: 0xb3 */
+0xc0,0x20,0x40,0xe0,
+/* char: 0xb4 */
+0x80,0x40,
+/* char: 0xb5 */
+0x80,0x80,0xf0,0x90,0x90,0x90,0x90,0x90,
+/* char: 0xb6 */
+0x28,0x28,0x28,0x28,0x28,0x68,0xe8,0xe8,0xe8,0x7c,
+/* char: 0xb7 */
+0xc0,
+/* char: 0xb8 */
+0xc0,0x40,
+/* char: 0xb9 */
+0x40,0x40,0xc0,0x40,
+/* char: 0xba */
+0xe0,0x0,0xe0,0xa0,0xe0,
+/* char: 0xbb */
+0xa0,0x50,0x28,0x50,0xa0,
+/* char: 0xbc */
+0x21,0x0,0x17,0x80,0x13,0x0,0x9,0x0,0x48,0x0,0x44,0x0,0xc4,0x0,0x42,0x0,
+/* char: 0xbd */
+0x27,0x12,0x15,0xb,0x48,0x44,0xc4,0x42,
+/* char: 0xbe */
+0x21,0x0,0x17,0x80,0x13,0x0,0x9,0x0,0xc8,0x0,0x24,0x0,0x44,0x0,0xe2,0x0,
+/* char: 0xbf */
+0x60,0x90,0x80,0x40,0x20,0x20,0x0,0x20,
+/* char: 0xc0 */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x10,0x20,
+/* char: 0xc1 */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x10,0x8,
+/* char: 0xc2 */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x28,0x10,
+/* char: 0xc3 */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x28,0x14,
+/* char: 0xc4 */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x0,0x28,
+/* char: 0xc5 */
+0x82,0x82,0x7c,0x44,0x28,0x28,0x10,0x10,0x10,0x28,0x10,
+/* char: 0xc6 */
+0x8f,0x80,0x88,0x0,0x78,0x0,0x48,0x0,0x2f,0x80,0x28,0x0,0x18,0x0,0x1f,0x80,
+/* char: 0xc7 */
+0x30,0x10,0x78,0x84,0x80,0x80,0x80,0x80,0x84,0x78,
+/* char: 0xc8 */
+0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,0x0,0x20,0x40,
+/* char: 0xc9 */
+0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,0x0,0x20,0x10,
+/* char: 0xca */
+0xf8,0x80,0x80,0xf8,0x80,0x80,0x80,0xf8,0x0,0x50,0x20,
+/* char: 0xcb */
+0xf8,0x80,0x80,0x80,0xf8,0x80,0x80,0xf8,0x0,0x50,
+/* char: 0xcc */
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x0,0x40,0x80,
+/* char: 0xcd */
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,0x40,
+/* char: 0xce */
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,0x40,
+/* char: 0xcf */
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,
+/* char: 0xd0 */
+0x78,0x44,0x42,0x42,0xf2,0x42,0x44,0x78,
+/* char: 0xd1 */
+0x8c,0x8c,0x94,0x94,0xa4,0xa4,0xc4,0xc4,0x0,0x50,0x28,
+/* char: 0xd2 */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x10,0x20,
+/* char: 0xd3 */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x10,0x8,
+/* char: 0xd4 */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x28,0x10,
+/* char: 0xd5 */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x50,0x28,
+/* char: 0xd6 */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x78,0x0,0x48,
+/* char: 0xd7 */
+0x88,0x50,0x20,0x50,0x88,
+/* char: 0xd8 */
+0x80,0x78,0xc4,0xa4,0xa4,0x94,0x94,0x8c,0x78,0x4,
+/* char: 0xd9 */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x10,0x20,
+/* char: 0xda */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x20,0x10,
+/* char: 0xdb */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x28,0x10,
+/* char: 0xdc */
+0x78,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x0,0x48,
+/* char: 0xdd */
+0x10,0x10,0x10,0x28,0x28,0x44,0x44,0x82,0x0,0x10,0x8,
+/* char: 0xde */
+0x80,0x80,0xf0,0x88,0x88,0xf0,0x80,0x80,
+/* char: 0xdf */
+0xa0,0x90,0x90,0x90,0xa0,0x90,0x90,0x60,
+/* char: 0xe0 */
+0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x20,0x40,
+/* char: 0xe1 */
+0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x20,0x10,
+/* char: 0xe2 */
+0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x50,0x20,
+/* char: 0xe3 */
+0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0xa0,0x50,
+/* char: 0xe4 */
+0x68,0x90,0x90,0x70,0x10,0xe0,0x0,0x50,
+/* char: 0xe5 */
+0x68,0x90,0x90,0x70,0x10,0xe0,0x20,0x50,0x20,
+/* char: 0xe6 */
+0x6c,0x92,0x90,0x7e,0x12,0xec,
+/* char: 0xe7 */
+0x60,0x20,0x60,0x90,0x80,0x80,0x90,0x60,
+/* char: 0xe8 */
+0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x20,0x40,
+/* char: 0xe9 */
+0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x40,0x20,
+/* char: 0xea */
+0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x50,0x20,
+/* char: 0xeb */
+0x60,0x90,0x80,0xf0,0x90,0x60,0x0,0x50,
+/* char: 0xec */
+0x40,0x40,0x40,0x40,0x40,0x40,0x0,0x40,0x80,
+/* char: 0xed */
+0x80,0x80,0x80,0x80,0x80,0x80,0x0,0x80,0x40,
+/* char: 0xee */
+0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,0x40,
+/* char: 0xef */
+0x40,0x40,0x40,0x40,0x40,0x40,0x0,0xa0,
+/* char: 0xf0 */
+0x70,0x88,0x88,0x88,0x88,0x78,0x90,0x60,0x50,
+/* char: 0xf1 */
+0x90,0x90,0x90,0x90,0x90,0xe0,0x0,0xa0,0x50,
+/* char: 0xf2 */
+0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x20,0x40,
+/* char: 0xf3 */
+0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x20,0x10,
+/* char: 0xf4 */
+0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x50,0x20,
+/* char: 0xf5 */
+0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x50,0x28,
+/* char: 0xf6 */
+0x70,0x88,0x88,0x88,0x88,0x70,0x0,0x50,
+/* char: 0xf7 */
+0x20,0x0,0xf8,0x0,0x20,
+/* char: 0xf8 */
+0x70,0x88,0xc8,0xa8,0x98,0x74,
+/* char: 0xf9 */
+0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x20,0x40,
+/* char: 0xfa */
+0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x40,0x20,
+/* char: 0xfb */
+0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x50,0x20,
+/* char: 0xfc */
+0x70,0x90,0x90,0x90,0x90,0x90,0x0,0x50,
+/* char: 0xfd */
+0x80,0x40,0x40,0x60,0xa0,0xa0,0x90,0x90,0x0,0x20,0x10,
+/* char: 0xfe */
+0x80,0x80,0xb0,0xc8,0x88,0x88,0xc8,0xb0,0x80,0x80,
+/* char: 0xff */
+0x80,0x40,0x40,0x60,0xa0,0xa0,0x90,0x90,0x0,0x50,
 };
 
-static const BitmapCharRec ch39 = {2,3,-1,-5,3,ch39data};
-
-/* char: 0x26 '&' */
-
-static const GLubyte ch38data[] = {
-0x64,0x98,0x98,0xa4,0x60,0x50,0x50,0x20,
-};
-
-static const BitmapCharRec ch38 = {6,8,-1,0,8,ch38data};
-
-/* char: 0x25 '%' */
-
-static const GLubyte ch37data[] = {
-0x26,0x29,0x16,0x10,0x8,0x68,0x94,0x64,
-};
-
-static const BitmapCharRec ch37 = {8,8,0,0,9,ch37data};
-
-/* char: 0x24 '$' */
-
-static const GLubyte ch36data[] = {
-0x20,0x70,0xa8,0x28,0x70,0xa0,0xa8,0x70,0x20,
-};
-
-static const BitmapCharRec ch36 = {5,9,0,1,6,ch36data};
-
-/* char: 0x23 '#' */
-
-static const GLubyte ch35data[] = {
-0x50,0x50,0xf8,0x28,0x7c,0x28,0x28,
-};
-
-static const BitmapCharRec ch35 = {6,7,0,0,6,ch35data};
-
-/* char: 0x22 '"' */
-
-static const GLubyte ch34data[] = {
-0xa0,0xa0,
-};
-
-static const BitmapCharRec ch34 = {3,2,-1,-6,4,ch34data};
-
-/* char: 0x21 '!' */
-
-static const GLubyte ch33data[] = {
-0x80,0x0,0x80,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch33 = {1,8,-1,0,3,ch33data};
-
-/* char: 0x20 ' ' */
-
-#ifdef _WIN32
-/* XXX Work around Microsoft OpenGL 1.1 bug where glBitmap with
-   a height or width of zero does not advance the raster position
-   as specified by OpenGL. (Cosmo OpenGL does not have this bug.) */
-static const GLubyte ch32data[] = { 0x0 };
-static const BitmapCharRec ch32 = {0,0,0,0,3,ch32data};
-#else
-static const BitmapCharRec ch32 = {0,0,0,0,3,0};
-#endif
-
-static const BitmapCharRec * const chars[] = {
-&ch32,
-&ch33,
-&ch34,
-&ch35,
-&ch36,
-&ch37,
-&ch38,
-&ch39,
-&ch40,
-&ch41,
-&ch42,
-&ch43,
-&ch44,
-&ch45,
-&ch46,
-&ch47,
-&ch48,
-&ch49,
-&ch50,
-&ch51,
-&ch52,
-&ch53,
-&ch54,
-&ch55,
-&ch56,
-&ch57,
-&ch58,
-&ch59,
-&ch60,
-&ch61,
-&ch62,
-&ch63,
-&ch64,
-&ch65,
-&ch66,
-&ch67,
-&ch68,
-&ch69,
-&ch70,
-&ch71,
-&ch72,
-&ch73,
-&ch74,
-&ch75,
-&ch76,
-&ch77,
-&ch78,
-&ch79,
-&ch80,
-&ch81,
-&ch82,
-&ch83,
-&ch84,
-&ch85,
-&ch86,
-&ch87,
-&ch88,
-&ch89,
-&ch90,
-&ch91,
-&ch92,
-&ch93,
-&ch94,
-&ch95,
-&ch96,
-&ch97,
-&ch98,
-&ch99,
-&ch100,
-&ch101,
-&ch102,
-&ch103,
-&ch104,
-&ch105,
-&ch106,
-&ch107,
-&ch108,
-&ch109,
-&ch110,
-&ch111,
-&ch112,
-&ch113,
-&ch114,
-&ch115,
-&ch116,
-&ch117,
-&ch118,
-&ch119,
-&ch120,
-&ch121,
-&ch122,
-&ch123,
-&ch124,
-&ch125,
-&ch126,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-&ch160,
-&ch161,
-&ch162,
-&ch163,
-&ch164,
-&ch165,
-&ch166,
-&ch167,
-&ch168,
-&ch169,
-&ch170,
-&ch171,
-&ch172,
-&ch173,
-&ch174,
-&ch175,
-&ch176,
-&ch177,
-&ch178,
-&ch179,
-&ch180,
-&ch181,
-&ch182,
-&ch183,
-&ch184,
-&ch185,
-&ch186,
-&ch187,
-&ch188,
-&ch189,
-&ch190,
-&ch191,
-&ch192,
-&ch193,
-&ch194,
-&ch195,
-&ch196,
-&ch197,
-&ch198,
-&ch199,
-&ch200,
-&ch201,
-&ch202,
-&ch203,
-&ch204,
-&ch205,
-&ch206,
-&ch207,
-&ch208,
-&ch209,
-&ch210,
-&ch211,
-&ch212,
-&ch213,
-&ch214,
-&ch215,
-&ch216,
-&ch217,
-&ch218,
-&ch219,
-&ch220,
-&ch221,
-&ch222,
-&ch223,
-&ch224,
-&ch225,
-&ch226,
-&ch227,
-&ch228,
-&ch229,
-&ch230,
-&ch231,
-&ch232,
-&ch233,
-&ch234,
-&ch235,
-&ch236,
-&ch237,
-&ch238,
-&ch239,
-&ch240,
-&ch241,
-&ch242,
-&ch243,
-&ch244,
-&ch245,
-&ch246,
-&ch247,
-&ch248,
-&ch249,
-&ch250,
-&ch251,
-&ch252,
-&ch253,
-&ch254,
-&ch255,
+static const BitmapCharRec chars[] = {
+{0,0,0,0,3,0},
+{1,8,-1,0,3,0},
+{3,2,-1,-6,4,8},
+{6,7,0,0,6,10},
+{5,9,0,1,6,17},
+{8,8,0,0,9,26},
+{6,8,-1,0,8,34},
+{2,3,-1,-5,3,42},
+{3,10,0,2,4,45},
+{3,10,-1,2,4,55},
+{3,3,0,-5,4,65},
+{5,5,0,-1,6,68},
+{2,3,0,2,3,73},
+{5,1,-1,-3,7,76},
+{1,1,-1,0,3,77},
+{3,8,0,0,3,78},
+{5,8,0,0,6,86},
+{2,8,-1,0,6,94},
+{5,8,0,0,6,102},
+{5,8,0,0,6,110},
+{5,8,0,0,6,118},
+{5,8,0,0,6,126},
+{5,8,0,0,6,134},
+{5,8,0,0,6,142},
+{5,8,0,0,6,150},
+{5,8,0,0,6,158},
+{1,6,-1,0,3,166},
+{2,8,0,2,3,172},
+{3,5,-1,-1,6,180},
+{4,3,0,-2,5,185},
+{3,5,-1,-1,6,188},
+{4,8,-1,0,6,193},
+{10,10,0,2,11,201},
+{7,8,0,0,7,221},
+{5,8,-1,0,7,229},
+{6,8,-1,0,8,237},
+{6,8,-1,0,8,245},
+{5,8,-1,0,7,253},
+{5,8,-1,0,6,261},
+{6,8,-1,0,8,269},
+{6,8,-1,0,8,277},
+{1,8,-1,0,3,285},
+{4,8,0,0,5,293},
+{5,8,-1,0,7,301},
+{4,8,-1,0,6,309},
+{7,8,-1,0,9,317},
+{6,8,-1,0,8,325},
+{6,8,-1,0,8,333},
+{5,8,-1,0,7,341},
+{7,9,-1,1,8,349},
+{5,8,-1,0,7,358},
+{5,8,-1,0,7,366},
+{5,8,0,0,5,374},
+{6,8,-1,0,8,382},
+{7,8,0,0,7,390},
+{9,8,0,0,9,398},
+{5,8,-1,0,7,414},
+{7,8,0,0,7,422},
+{5,8,-1,0,7,430},
+{2,10,-1,2,3,438},
+{3,8,0,0,3,448},
+{2,10,0,2,3,456},
+{5,5,0,-3,6,466},
+{6,1,0,2,6,471},
+{2,3,0,-5,3,472},
+{5,6,0,0,5,475},
+{5,8,0,0,6,481},
+{4,6,0,0,5,489},
+{5,8,0,0,6,495},
+{4,6,0,0,5,503},
+{4,8,0,0,4,509},
+{5,8,0,2,6,517},
+{5,8,0,0,6,525},
+{1,8,0,0,2,533},
+{1,9,0,1,2,541},
+{4,8,0,0,5,550},
+{1,8,0,0,2,558},
+{7,6,0,0,8,566},
+{5,6,0,0,6,572},
+{5,6,0,0,6,578},
+{5,8,0,2,6,584},
+{5,8,0,2,6,592},
+{3,6,0,0,4,600},
+{4,6,0,0,5,606},
+{3,8,0,0,4,612},
+{4,6,0,0,5,620},
+{5,6,0,0,6,626},
+{7,6,0,0,8,632},
+{5,6,0,0,6,638},
+{4,8,0,2,5,644},
+{4,6,0,0,5,652},
+{3,10,0,2,3,658},
+{1,10,-1,2,3,668},
+{3,10,0,2,3,678},
+{6,2,0,-3,7,688},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,3,0},
+{1,8,-1,2,3,690},
+{5,8,0,1,6,698},
+{5,8,0,0,6,706},
+{4,6,0,-1,5,714},
+{5,8,0,0,6,720},
+{1,10,-1,2,3,728},
+{5,10,0,2,6,738},
+{3,1,0,-7,3,748},
+{7,7,-1,0,9,749},
+{3,5,0,-3,4,756},
+{5,5,0,0,6,761},
+{5,3,-1,-2,7,766},
+{3,1,0,-3,4,769},
+{7,7,-1,0,9,770},
+{3,1,0,-7,3,777},
+{4,4,0,-3,4,778},
+{5,7,0,0,6,782},
+{3,4,0,-3,3,789},
+{3,4,0,-3,3,793},
+{2,2,0,-6,3,797},
+{4,8,0,2,5,799},
+{6,10,0,2,6,807},
+{2,1,0,-3,3,817},
+{2,2,0,2,3,818},
+{2,4,0,-3,3,820},
+{3,5,0,-3,4,824},
+{5,5,0,0,6,829},
+{9,8,0,0,9,834},
+{8,8,0,0,9,850},
+{9,8,0,0,9,858},
+{4,8,-1,2,6,874},
+{7,11,0,0,7,882},
+{7,11,0,0,7,893},
+{7,11,0,0,7,904},
+{7,11,0,0,7,915},
+{7,10,0,0,7,926},
+{7,11,0,0,7,936},
+{9,8,0,0,10,947},
+{6,10,-1,2,8,963},
+{5,11,-1,0,7,973},
+{5,11,-1,0,7,984},
+{5,11,-1,0,7,995},
+{5,10,-1,0,7,1006},
+{2,11,0,0,3,1016},
+{2,11,-1,0,3,1027},
+{3,11,0,0,3,1038},
+{3,10,0,0,3,1049},
+{7,8,0,0,8,1059},
+{6,11,-1,0,8,1067},
+{6,11,-1,0,8,1078},
+{6,11,-1,0,8,1089},
+{6,11,-1,0,8,1100},
+{6,11,-1,0,8,1111},
+{6,10,-1,0,8,1122},
+{5,5,0,-1,6,1132},
+{6,10,-1,1,8,1137},
+{6,11,-1,0,8,1147},
+{6,11,-1,0,8,1158},
+{6,11,-1,0,8,1169},
+{6,10,-1,0,8,1180},
+{7,11,0,0,7,1190},
+{5,8,-1,0,7,1201},
+{4,8,0,0,5,1209},
+{5,9,0,0,5,1217},
+{5,9,0,0,5,1226},
+{5,9,0,0,5,1235},
+{5,9,0,0,5,1244},
+{5,8,0,0,5,1253},
+{5,9,0,0,5,1261},
+{7,6,0,0,8,1270},
+{4,8,0,2,5,1276},
+{4,9,0,0,5,1284},
+{4,9,0,0,5,1293},
+{4,9,0,0,5,1302},
+{4,8,0,0,5,1311},
+{2,9,1,0,2,1319},
+{2,9,0,0,2,1328},
+{3,9,1,0,2,1337},
+{3,8,0,0,2,1346},
+{5,9,0,0,6,1354},
+{4,9,0,0,5,1363},
+{5,9,0,0,6,1372},
+{5,9,0,0,6,1381},
+{5,9,0,0,6,1390},
+{5,9,0,0,6,1399},
+{5,8,0,0,6,1408},
+{5,5,0,-1,6,1416},
+{6,6,0,0,6,1421},
+{4,9,0,0,5,1427},
+{4,9,0,0,5,1436},
+{4,9,0,0,5,1445},
+{4,8,0,0,5,1454},
+{4,11,0,2,5,1462},
+{5,10,0,2,6,1473},
+{4,10,0,2,5,1483},
 };
 
 const BitmapFontRec glutBitmapHelvetica10 = {
 224,
 32,
-chars
+chars,
+bitmaps
 };
-
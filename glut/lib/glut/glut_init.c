@@ -303,36 +303,6 @@ __glutOpenXConnection(char *display)
 }
 #endif /* _WIN32 */
 
-#ifdef _WIN32
-DWORD
-__glutInitTime(void)
-{
-  static int beenhere = 0;
-  static DWORD genesis;
-
-  if (!beenhere) {
-    /* GetTickCount has 5 millisecond accuracy on Windows 98
-       and 10 millisecond accuracy on Windows NT 4.0. */
-    genesis = GetTickCount();
-    beenhere = 1;
-  }
-  return genesis;
-}
-#else /* !_WIN32 */
-void
-__glutInitTime(struct timeval *beginning)
-{
-  static int beenhere = 0;
-  static struct timeval genesis;
-
-  if (!beenhere) {
-    GETTIMEOFDAY(&genesis);
-    beenhere = 1;
-  }
-  *beginning = genesis;
-}
-#endif /* _WIN32 */
-
 static void
 removeArgs(int *argcp, char **argv, int numToRemove)
 {
@@ -350,12 +320,11 @@ glutInit(int *argcp, char **argv)
 {
   char *display = NULL;
   char *str, *geometry = NULL;
-#ifndef _WIN32
-  struct timeval unused;
-#endif
+  GLboolean useTSC = GL_FALSE, useNull = GL_FALSE, useEGL = GL_FALSE;
+  GLboolean useVirtualClock = GL_FALSE;
   int i;
 
-  if (__glutDisplay) {
+  if (__glutDisplay || __glutNullWindowSystem) {
     __glutWarning("glutInit being called a second time.");
     return;
   }
@@ -443,6 +412,26 @@ glutInit(int *argcp, char **argv)
 #endif
       synchronize = GL_TRUE;
       removeArgs(argcp, &argv[1], 1);
+    } else if (!strcmp(__glutArgv[i], "-tsc")) {
+      useTSC = GL_TRUE;
+      removeArgs(argcp, &argv[1], 1);
+    } else if (!strcmp(__glutArgv[i], "-virtualclock")) {
+      useVirtualClock = GL_TRUE;
+      removeArgs(argcp, &argv[1], 1);
+    } else if (!strcmp(__glutArgv[i], "-null")) {
+#if defined(_WIN32)
+      __glutWarning("-null option not supported by Win32 GLUT.");
+#endif
+      useNull = GL_TRUE;
+      removeArgs(argcp, &argv[1], 1);
+    } else if (!strcmp(__glutArgv[i], "-egl")) {
+#if defined(_WIN32)
+      __glutWarning("-egl option not supported by Win32 GLUT.");
+#endif
+      /* The null window system, rendering with EGL. */
+      useNull = GL_TRUE;
+      useEGL = GL_TRUE;
+      removeArgs(argcp, &argv[1], 1);
     } else {
       /* Once unknown option encountered, stop command line
          processing. */
@@ -452,7 +441,14 @@ glutInit(int *argcp, char **argv)
 #if defined(_WIN32)
   __glutOpenWin32Connection(display);
 #else
-  __glutOpenXConnection(display);
+  if (useNull) {
+    __glutNullOpenConnection();
+    if (useEGL) {
+      __glutEGLOpenDisplay();
+    }
+  } else {
+    __glutOpenXConnection(display);
+  }
 #endif
   if (geometry) {
     int flags, x, y, width, height;
@@ -481,8 +477,7 @@ glutInit(int *argcp, char **argv)
     glutInitWindowSize(__glutInitWidth, __glutInitHeight);
     if (XValue & flags) {
       if (XNegative & flags) {
-        x = DisplayWidth(__glutDisplay, __glutScreen) +
-          x - __glutSizeHints.width;
+        x = __glutScreenWidth + x - __glutSizeHints.width;
       }
       /* Play safe: reject negative X locations */
       if (x >= 0) {
@@ -491,8 +486,7 @@ glutInit(int *argcp, char **argv)
     }
     if (YValue & flags) {
       if (YNegative & flags) {
-        y = DisplayHeight(__glutDisplay, __glutScreen) +
-          y - __glutSizeHints.height;
+        y = __glutScreenHeight + y - __glutSizeHints.height;
       }
       /* Play safe: reject negative Y locations */
       if (y >= 0) {
@@ -501,11 +495,12 @@ glutInit(int *argcp, char **argv)
     }
     glutInitWindowPosition(__glutInitX, __glutInitY);
   }
-#ifdef _WIN32
-  (void) __glutInitTime();
-#else
-  __glutInitTime(&unused);
-#endif
+  if (useVirtualClock) {
+    __glutInitClock(GLUT_CLOCK_VIRTUAL);
+  } else {
+    __glutInitClock(useTSC ? GLUT_CLOCK_TSC : GLUT_CLOCK_MONOTONIC);
+  }
+  __glutInitWakeup();
 }
 
 #ifdef _WIN32
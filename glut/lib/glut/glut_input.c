@@ -358,6 +358,10 @@ probeDevices(void)
   been_here = True;
 
 #if !defined(_WIN32)
+  if (__glutNullWindowSystem) {
+    /* No X Input extension devices to find. */
+    return support;
+  }
   version = XGetExtensionVersion(__glutDisplay, "XInputExtension");
   /* Ugh.  XInput extension API forces annoying cast of a pointer
      to a long so it can be compared with the NoSuchExtension
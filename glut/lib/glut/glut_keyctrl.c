@@ -20,6 +20,9 @@ glutSetKeyRepeat(int repeatMode)
 #if !defined(_WIN32)
   XKeyboardControl values;
 
+  if (__glutNullWindowSystem) {
+    return;
+  }
   /* GLUT's repeatMode #define's match the Xlib API values. */
   values.auto_repeat_mode = repeatMode;
   XChangeKeyboardControl(__glutDisplay, KBAutoRepeatMode, &values);
@@ -839,7 +839,7 @@ glutCreateMenu(GLUTselectCB selectFunc)
   if (__glutMappedMenu) {
     __glutMenuModificationError();
   }
-  if (!__glutDisplay) {
+  if (!__glutDisplay && !__glutNullWindowSystem) {
     __glutOpenXConnection(NULL);
   }
 
@@ -861,6 +861,14 @@ glutCreateMenu(GLUTselectCB selectFunc)
   menu->cascade = NULL;
   menu->highlighted = NULL;
   menu->anchor = NULL;
+  if (__glutNullWindowSystem) {
+    /* Menus never pop up without a window system, but keep
+       their items so programs can build and change them. */
+    menu->win = __glutNullCreateWindow(__glutRoot, 0, 0, 1, 1);
+    __glutMenuList[menuid] = menu;
+    __glutSetMenu(menu);
+    return menuid + 1;
+  }
   menuSetup();
   wa.override_redirect = True;
   wa.background_pixel = menuGray;
@@ -930,7 +938,11 @@ __glutSetMenuItem(GLUTmenuItem * item, const char *label,
   item->isTrigger = isTrigger;
   item->len = (int) strlen(label);
   item->value = value;
-  item->pixwidth = XTextWidth(menuFont, label, item->len) + 4;
+  if (__glutNullWindowSystem) {
+    item->pixwidth = 9 * item->len + 4;  /* As if in 9x15. */
+  } else {
+    item->pixwidth = XTextWidth(menuFont, label, item->len) + 4;
+  }
   if (item->pixwidth > menu->pixwidth) {
     menu->pixwidth = item->pixwidth;
   }
@@ -953,14 +965,19 @@ glutAddMenuEntry(const char *label, int value)
   }
   entry->menu = __glutCurrentMenu;
   __glutSetMenuItem(entry, label, value, False);
-  wa.event_mask = EnterWindowMask | LeaveWindowMask;
-  entry->win = XCreateWindow(__glutDisplay,
-    __glutCurrentMenu->win, MENU_GAP,
-    __glutCurrentMenu->num * fontHeight + MENU_GAP,  /* x & y */
-    entry->pixwidth, fontHeight,  /* width & height */
-    0, CopyFromParent, InputOnly, CopyFromParent,
-    CWEventMask, &wa);
-  XMapWindow(__glutDisplay, entry->win);
+  if (__glutNullWindowSystem) {
+    entry->win = __glutNullCreateWindow(__glutCurrentMenu->win,
+      0, 0, entry->pixwidth, 1);
+  } else {
+    wa.event_mask = EnterWindowMask | LeaveWindowMask;
+    entry->win = XCreateWindow(__glutDisplay,
+      __glutCurrentMenu->win, MENU_GAP,
+      __glutCurrentMenu->num * fontHeight + MENU_GAP,  /* x & y */
+      entry->pixwidth, fontHeight,  /* width & height */
+      0, CopyFromParent, InputOnly, CopyFromParent,
+      CWEventMask, &wa);
+    XMapWindow(__glutDisplay, entry->win);
+  }
   __glutCurrentMenu->num++;
   entry->next = __glutCurrentMenu->list;
   __glutCurrentMenu->list = entry;
@@ -982,14 +999,19 @@ glutAddSubMenu(const char *label, int menu)
   __glutCurrentMenu->submenus++;
   submenu->menu = __glutCurrentMenu;
   __glutSetMenuItem(submenu, label, /* base 0 */ menu - 1, True);
-  wa.event_mask = EnterWindowMask | LeaveWindowMask;
-  submenu->win = XCreateWindow(__glutDisplay,
-    __glutCurrentMenu->win, MENU_GAP,
-    __glutCurrentMenu->num * fontHeight + MENU_GAP,  /* x & y */
-    submenu->pixwidth, fontHeight,  /* width & height */
-    0, CopyFromParent, InputOnly, CopyFromParent,
-    CWEventMask, &wa);
-  XMapWindow(__glutDisplay, submenu->win);
+  if (__glutNullWindowSystem) {
+    submenu->win = __glutNullCreateWindow(__glutCurrentMenu->win,
+      0, 0, submenu->pixwidth, 1);
+  } else {
+    wa.event_mask = EnterWindowMask | LeaveWindowMask;
+    submenu->win = XCreateWindow(__glutDisplay,
+      __glutCurrentMenu->win, MENU_GAP,
+      __glutCurrentMenu->num * fontHeight + MENU_GAP,  /* x & y */
+      submenu->pixwidth, fontHeight,  /* width & height */
+      0, CopyFromParent, InputOnly, CopyFromParent,
+      CWEventMask, &wa);
+    XMapWindow(__glutDisplay, submenu->win);
+  }
   __glutCurrentMenu->num++;
   submenu->next = __glutCurrentMenu->list;
   __glutCurrentMenu->list = submenu;
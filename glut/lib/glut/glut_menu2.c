@@ -47,8 +47,15 @@ glutDestroyMenu(int menunum)
     __glutMenuModificationError();
   }
   assert(menu->id == menunum - 1);
-  XDestroySubwindows(__glutDisplay, menu->win);
-  XDestroyWindow(__glutDisplay, menu->win);
+#if !defined(_WIN32)
+  if (__glutNullWindowSystem) {
+    __glutNullDestroyWindow(menu->win);
+  } else
+#endif
+  {
+    XDestroySubwindows(__glutDisplay, menu->win);
+    XDestroyWindow(__glutDisplay, menu->win);
+  }
   __glutMenuList[menunum - 1] = NULL;
   /* free all menu entries */
   item = menu->list;
@@ -0,0 +1,742 @@
+
+/* Copyright (c) Mark J. Kilgard, 2026. */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* The null window system, selected with "glutInit -null", stands
+   in for the X server so GLUT's main loop, timers, work lists and
+   callback dispatch run on machines with no display.  Windows are
+   just IDs with a position and size; nothing is drawn and no OpenGL
+   context is ever current.  Input reaches the program only through
+   the glutInject routines below, which queue the same X events a
+   server would send, so the main loop dispatches them exactly as
+   it dispatches real ones.  Window work (map, configure) is done
+   here, queueing the Expose and ConfigureNotify events an X server
+   would answer it with. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifndef _WIN32
+#include <X11/keysym.h>
+#endif
+
+#include "glutint.h"
+
+GLboolean __glutNullWindowSystem = GL_FALSE;
+
+#if !defined(_WIN32)
+
+#define NULL_SCREEN_WIDTH  1920
+#define NULL_SCREEN_HEIGHT 1080
+
+typedef struct _GLUTnullWindow GLUTnullWindow;
+struct _GLUTnullWindow {
+  Window parent;
+  int x, y;              /* relative to parent */
+  int width, height;
+  Bool mapped;
+};
+
+/* Indexed by window ID less one; the root window is ID 1.  IDs are
+   never reused, so events queued for a destroyed window find no
+   GLUT window, as with X. */
+static GLUTnullWindow *nullWindows = NULL;
+static int nullWindowCount = 0, nullWindowTableSize = 0;
+
+/* Ring of queued events; queueSize is a power of two. */
+static XEvent *queue = NULL;
+static int queueSize = 0, queueHead = 0, queueCount = 0;
+static unsigned long serial = 0;
+
+/* Pointer state carried by the events injected. */
+static unsigned int buttonMask = 0;
+static unsigned int modifierMask = 0;
+
+void
+__glutNullOpenConnection(void)
+{
+  __glutNullWindowSystem = GL_TRUE;
+  __glutScreen = 0;
+  __glutScreenWidth = NULL_SCREEN_WIDTH;
+  __glutScreenHeight = NULL_SCREEN_HEIGHT;
+  __glutConnectionFD = -1;
+  __glutRoot = __glutNullCreateWindow(None, 0, 0,
+    NULL_SCREEN_WIDTH, NULL_SCREEN_HEIGHT);
+  nullWindows[0].mapped = True;
+}
+
+static GLUTnullWindow *
+nullWindow(Window win)
+{
+  if (win < 1 || win > (Window) nullWindowCount) {
+    return NULL;
+  }
+  return &nullWindows[win - 1];
+}
+
+Window
+__glutNullCreateWindow(Window parent, int x, int y,
+  int width, int height)
+{
+  GLUTnullWindow *window;
+
+  if (nullWindowCount == nullWindowTableSize) {
+    int size = nullWindowTableSize ? 2 * nullWindowTableSize : 16;
+    GLUTnullWindow *table = (GLUTnullWindow *)
+      realloc(nullWindows, size * sizeof(GLUTnullWindow));
+
+    if (!table) {
+      __glutFatalError("out of memory.");
+    }
+    nullWindows = table;
+    nullWindowTableSize = size;
+  }
+  window = &nullWindows[nullWindowCount++];
+  window->parent = parent;
+  window->x = x < 0 ? 0 : x;
+  window->y = y < 0 ? 0 : y;
+  window->width = width;
+  window->height = height;
+  window->mapped = False;
+  return (Window) nullWindowCount;
+}
+
+void
+__glutNullDestroyWindow(Window win)
+{
+  GLUTnullWindow *window = nullWindow(win);
+
+  if (window) {
+    window->parent = None;
+    window->mapped = False;
+  }
+}
+
+static XEvent *
+queueEvent(int type, Window win)
+{
+  XEvent *event;
+
+  if (queueCount == queueSize) {
+    int size = queueSize ? 2 * queueSize : 64;
+    XEvent *ring = (XEvent *) malloc(size * sizeof(XEvent));
+    int i;
+
+    if (!ring) {
+      __glutFatalError("out of memory.");
+    }
+    for (i = 0; i < queueCount; i++) {
+      ring[i] = queue[(queueHead + i) & (queueSize - 1)];
+    }
+    free(queue);
+    queue = ring;
+    queueSize = size;
+    queueHead = 0;
+  }
+  event = &queue[(queueHead + queueCount) & (queueSize - 1)];
+  queueCount++;
+  memset(event, 0, sizeof(XEvent));
+  event->xany.type = type;
+  event->xany.serial = ++serial;
+  event->xany.window = win;
+  return event;
+}
+
+int
+__glutNullEventsQueued(void)
+{
+  return queueCount;
+}
+
+void
+__glutNullPeekEvent(XEvent * event)
+{
+  assert(queueCount > 0);
+  *event = queue[queueHead];
+}
+
+void
+__glutNullNextEvent(XEvent * event)
+{
+  assert(queueCount > 0);
+  *event = queue[queueHead];
+  queueHead = (queueHead + 1) & (queueSize - 1);
+  queueCount--;
+}
+
+static void
+rootPosition(Window win, int *x, int *y)
+{
+  GLUTnullWindow *window;
+
+  *x = 0;
+  *y = 0;
+  while ((window = nullWindow(win)) && window->parent != None) {
+    *x += window->x;
+    *y += window->y;
+    win = window->parent;
+  }
+}
+
+static void
+queueConfigure(Window win)
+{
+  GLUTnullWindow *window = nullWindow(win);
+  XEvent *event = queueEvent(ConfigureNotify, win);
+
+  event->xconfigure.window = win;
+  event->xconfigure.x = window->x;
+  event->xconfigure.y = window->y;
+  event->xconfigure.width = window->width;
+  event->xconfigure.height = window->height;
+}
+
+static void
+queueUnmap(Window win)
+{
+  XEvent *event = queueEvent(UnmapNotify, win);
+
+  event->xunmap.window = win;
+}
+
+/* Does the map and configure work processWindowWork would have the
+   X server do, queueing the events the server would send back. */
+void
+__glutNullWindowWork(GLUTwindow * window, int workMask)
+{
+  GLUTnullWindow *nw = nullWindow(window->win);
+  XEvent *event;
+
+  if (workMask & GLUT_CONFIGURE_WORK) {
+    if (window->desiredConfMask & CWX) {
+      nw->x = window->desiredX;
+    }
+    if (window->desiredConfMask & CWY) {
+      nw->y = window->desiredY;
+    }
+    if (window->desiredConfMask & CWWidth) {
+      nw->width = window->desiredWidth;
+    }
+    if (window->desiredConfMask & CWHeight) {
+      nw->height = window->desiredHeight;
+    }
+    window->desiredConfMask = 0;
+    queueConfigure(window->win);
+  }
+  if (workMask & GLUT_MAP_WORK) {
+    switch (window->desiredMapState) {
+    case WithdrawnState:
+    case IconicState:
+      if (nw->mapped) {
+        nw->mapped = False;
+        queueUnmap(window->win);
+      }
+      window->shownState = 0;
+      break;
+    case NormalState:
+      if (!nw->mapped) {
+        nw->mapped = True;
+        event = queueEvent(VisibilityNotify, window->win);
+        event->xvisibility.state = VisibilityUnobscured;
+        queueEvent(Expose, window->win);
+      }
+      window->shownState = 1;
+      break;
+    }
+  }
+}
+
+/* Answers glutGet queries that would otherwise ask the X server
+   or GLX, returning zero for queries glutGet answers itself. */
+int
+__glutNullGet(GLenum param, int *value)
+{
+  GLUTnullWindow *window;
+  int x, y;
+
+  switch (param) {
+  case GLUT_WINDOW_X:
+  case GLUT_WINDOW_Y:
+    rootPosition(__glutCurrentWindow->win, &x, &y);
+    *value = param == GLUT_WINDOW_X ? x : y;
+    return 1;
+  case GLUT_WINDOW_WIDTH:
+  case GLUT_WINDOW_HEIGHT:
+    window = nullWindow(__glutCurrentWindow->win);
+    *value = param == GLUT_WINDOW_WIDTH ? window->width : window->height;
+    return 1;
+  case GLUT_WINDOW_RGBA:
+    *value = GLUT_WIND_IS_RGB(__glutDisplayMode);
+    return 1;
+  case GLUT_WINDOW_DOUBLEBUFFER:
+    *value = GLUT_WIND_IS_DOUBLE(__glutDisplayMode);
+    return 1;
+  case GLUT_WINDOW_BUFFER_SIZE:
+  case GLUT_WINDOW_STENCIL_SIZE:
+  case GLUT_WINDOW_DEPTH_SIZE:
+  case GLUT_WINDOW_RED_SIZE:
+  case GLUT_WINDOW_GREEN_SIZE:
+  case GLUT_WINDOW_BLUE_SIZE:
+  case GLUT_WINDOW_ALPHA_SIZE:
+  case GLUT_WINDOW_ACCUM_RED_SIZE:
+  case GLUT_WINDOW_ACCUM_GREEN_SIZE:
+  case GLUT_WINDOW_ACCUM_BLUE_SIZE:
+  case GLUT_WINDOW_ACCUM_ALPHA_SIZE:
+  case GLUT_WINDOW_COLORMAP_SIZE:
+  case GLUT_WINDOW_NUM_SAMPLES:
+  case GLUT_WINDOW_STEREO:
+  case GLUT_WINDOW_FORMAT_ID:
+    if (__glutUseEGL && __glutEGLGet(param, value)) {
+      return 1;
+    }
+    /* There is no framebuffer (or EGL lacks the buffer). */
+    *value = 0;
+    return 1;
+  case GLUT_SCREEN_WIDTH:
+    *value = __glutScreenWidth;
+    return 1;
+  case GLUT_SCREEN_HEIGHT:
+    *value = __glutScreenHeight;
+    return 1;
+  case GLUT_SCREEN_WIDTH_MM:
+    *value = __glutScreenWidth * 254 / 960;  /* 96 dpi */
+    return 1;
+  case GLUT_SCREEN_HEIGHT_MM:
+    *value = __glutScreenHeight * 254 / 960;
+    return 1;
+  case GLUT_DISPLAY_MODE_POSSIBLE:
+    *value = 1;
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+/* Injected key events carry their keysym as the keycode, so these
+   stand in for XLookupString and XLookupKeysym. */
+int
+__glutNullLookupString(XKeyEvent * event, char *buffer)
+{
+  KeySym ks = (KeySym) event->keycode;
+  int c;
+
+  if ((ks >= XK_space && ks <= XK_asciitilde) ||
+    (ks >= XK_nobreakspace && ks <= XK_ydiaeresis)) {
+    c = (int) ks;
+    if ((event->state & ControlMask) &&
+      ((c >= '@' && c < '\177') || c == ' ')) {
+      c &= 0x1f;
+    }
+  } else {
+    switch (ks) {
+    case XK_BackSpace:
+    case XK_Tab:
+    case XK_Return:
+    case XK_Escape:
+      c = (int) (ks & 0xff);
+      break;
+    case XK_Delete:
+      c = 127;
+      break;
+    default:
+      return 0;
+    }
+  }
+  buffer[0] = (char) c;
+  return 1;
+}
+
+KeySym
+__glutNullLookupKeysym(XKeyEvent * event)
+{
+  return (KeySym) event->keycode;
+}
+
+static GLUTwindow *
+injectWindow(char *routine, int win)
+{
+  if (!__glutNullWindowSystem) {
+    __glutWarning("%s needs the null window system (glutInit -null).",
+      routine);
+    return NULL;
+  }
+  if (win < 1 || win > __glutWindowListSize || !__glutWindowList[win - 1]) {
+    __glutWarning("%s attempted on bogus window.", routine);
+    return NULL;
+  }
+  return __glutWindowList[win - 1];
+}
+
+static XEvent *
+queuePointerEvent(int type, GLUTwindow * window, int x, int y)
+{
+  XEvent *event = queueEvent(type, window->win);
+  int rootX, rootY;
+
+  rootPosition(window->win, &rootX, &rootY);
+  /* XButtonEvent, XMotionEvent, XKeyEvent and (up to its state)
+     XCrossingEvent share this layout. */
+  event->xbutton.root = __glutRoot;
+  event->xbutton.time = (Time) (__glutClockNow() / 1000000);
+  event->xbutton.x = x;
+  event->xbutton.y = y;
+  event->xbutton.x_root = rootX + x;
+  event->xbutton.y_root = rootY + y;
+  event->xbutton.state = modifierMask | buttonMask;
+  event->xbutton.same_screen = True;
+  return event;
+}
+
+void
+__glutNullWarpPointer(GLUTwindow * window, int x, int y)
+{
+  queuePointerEvent(MotionNotify, window, x, y);
+}
+
+/* CENTRY */
+void GLUTAPIENTRY
+glutInjectModifiers(int modifiers)
+{
+  modifierMask = 0;
+  if (modifiers & GLUT_ACTIVE_SHIFT) {
+    modifierMask |= ShiftMask;
+  }
+  if (modifiers & GLUT_ACTIVE_CTRL) {
+    modifierMask |= ControlMask;
+  }
+  if (modifiers & GLUT_ACTIVE_ALT) {
+    modifierMask |= Mod1Mask;
+  }
+}
+
+void GLUTAPIENTRY
+glutInjectMouse(int win, int button, int state, int x, int y)
+{
+  GLUTwindow *window = injectWindow("glutInjectMouse", win);
+  XEvent *event;
+
+  if (!window) {
+    return;
+  }
+  if (button < GLUT_LEFT_BUTTON || button > GLUT_RIGHT_BUTTON) {
+    __glutWarning("glutInjectMouse: bogus button %d.", button);
+    return;
+  }
+  /* Like X, report the button state from before the event. */
+  event = queuePointerEvent(state == GLUT_DOWN ? ButtonPress : ButtonRelease,
+    window, x, y);
+  event->xbutton.button = button + 1;
+  if (state == GLUT_DOWN) {
+    buttonMask |= Button1Mask << button;
+  } else {
+    buttonMask &= ~(Button1Mask << button);
+  }
+}
+
+void GLUTAPIENTRY
+glutInjectMotion(int win, int x, int y)
+{
+  GLUTwindow *window = injectWindow("glutInjectMotion", win);
+
+  if (window) {
+    queuePointerEvent(MotionNotify, window, x, y);
+  }
+}
+
+void GLUTAPIENTRY
+glutInjectEntry(int win, int state, int x, int y)
+{
+  GLUTwindow *window = injectWindow("glutInjectEntry", win);
+  XEvent *event;
+
+  if (window) {
+    event = queuePointerEvent(state == GLUT_ENTERED ? EnterNotify : LeaveNotify,
+      window, x, y);
+    event->xcrossing.mode = NotifyNormal;
+    event->xcrossing.detail = NotifyAncestor;
+    event->xcrossing.focus = True;
+    event->xcrossing.state = modifierMask | buttonMask;
+  }
+}
+
+static void
+queueKey(GLUTwindow * window, KeySym ks, unsigned int state,
+  int down, int x, int y)
+{
+  XEvent *event = queuePointerEvent(down == GLUT_DOWN ? KeyPress : KeyRelease,
+    window, x, y);
+
+  /* XKeyEvent differs from XButtonEvent only past state. */
+  event->xkey.state |= state;
+  event->xkey.keycode = (unsigned int) ks;
+}
+
+void GLUTAPIENTRY
+glutInjectKeyboard(int win, unsigned char key, int state, int x, int y)
+{
+  GLUTwindow *window = injectWindow("glutInjectKeyboard", win);
+  unsigned int control = 0;
+  KeySym ks;
+
+  if (!window) {
+    return;
+  }
+  switch (key) {
+  case '\b':
+  case '\t':
+  case '\r':
+  case 27:
+    ks = 0xff00 | key;  /* XK_BackSpace, XK_Tab, XK_Return, XK_Escape */
+    break;
+  case 127:
+    ks = XK_Delete;
+    break;
+  default:
+    if (key < ' ') {
+      /* A control character; send the key it is typed with. */
+      ks = key + (key >= 1 && key <= 26 ? 'a' - 1 : '@');
+      control = ControlMask;
+    } else {
+      ks = key;  /* Latin-1 keysyms match their characters. */
+    }
+    break;
+  }
+  queueKey(window, ks, control, state, x, y);
+}
+
+void GLUTAPIENTRY
+glutInjectSpecial(int win, int key, int state, int x, int y)
+{
+  GLUTwindow *window = injectWindow("glutInjectSpecial", win);
+  KeySym ks;
+
+  if (!window) {
+    return;
+  }
+  if (key >= GLUT_KEY_F1 && key <= GLUT_KEY_F12) {
+    ks = XK_F1 + (key - GLUT_KEY_F1);
+  } else {
+    switch (key) {
+    /* *INDENT-OFF* */
+    case GLUT_KEY_LEFT:      ks = XK_Left; break;
+    case GLUT_KEY_UP:        ks = XK_Up; break;
+    case GLUT_KEY_RIGHT:     ks = XK_Right; break;
+    case GLUT_KEY_DOWN:      ks = XK_Down; break;
+    case GLUT_KEY_PAGE_UP:   ks = XK_Prior; break;
+    case GLUT_KEY_PAGE_DOWN: ks = XK_Next; break;
+    case GLUT_KEY_HOME:      ks = XK_Home; break;
+    case GLUT_KEY_END:       ks = XK_End; break;
+    case GLUT_KEY_INSERT:    ks = XK_Insert; break;
+    /* *INDENT-ON* */
+    default:
+      __glutWarning("glutInjectSpecial: bogus key %d.", key);
+      return;
+    }
+  }
+  queueKey(window, ks, 0, state, x, y);
+}
+
+void GLUTAPIENTRY
+glutInjectReshape(int win, int width, int height)
+{
+  GLUTwindow *window = injectWindow("glutInjectReshape", win);
+  GLUTnullWindow *nw;
+
+  if (!window) {
+    return;
+  }
+  if (width < 1 || height < 1) {
+    __glutWarning("glutInjectReshape: bogus size %dx%d.", width, height);
+    return;
+  }
+  nw = nullWindow(window->win);
+  nw->width = width;
+  nw->height = height;
+  queueConfigure(window->win);
+}
+
+void GLUTAPIENTRY
+glutInjectWindowStatus(int win, int state)
+{
+  GLUTwindow *window = injectWindow("glutInjectWindowStatus", win);
+  XEvent *event;
+
+  if (!window) {
+    return;
+  }
+  if (state == GLUT_HIDDEN) {
+    queueUnmap(window->win);
+  } else {
+    /* GLUT_FULLY_RETAINED is VisibilityUnobscured+1, and so on. */
+    event = queueEvent(VisibilityNotify, window->win);
+    event->xvisibility.state = state - 1;
+  }
+}
+/* ENDCENTRY */
+
+#else /* _WIN32 */
+
+/* Win32 GLUT has no null window system, so there is nothing to
+   inject into. */
+
+/* CENTRY */
+void GLUTAPIENTRY
+glutInjectModifiers(int modifiers)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectMouse(int win, int button, int state, int x, int y)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectMotion(int win, int x, int y)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectEntry(int win, int state, int x, int y)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectKeyboard(int win, unsigned char key, int state, int x, int y)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectSpecial(int win, int key, int state, int x, int y)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectReshape(int win, int width, int height)
+{
+}
+
+void GLUTAPIENTRY
+glutInjectWindowStatus(int win, int state)
+{
+}
+/* ENDCENTRY */
+
+#endif /* _WIN32 */
+
+#ifdef TEST
+
+/* Benchmark: times the main loop dispatching injected passive motion
+   events and redisplays across 100 windows with no window system or
+   OpenGL underneath, so all that is measured is GLUT itself; or,
+   given -egl, with each redisplay clearing a pbuffer and swapping.
+   A key event ends each batch of motions, so its callback sees
+   every motion before it dispatched. */
+
+#include <stdio.h>
+
+#define WINDOWS 100
+#define BATCH 10000
+#define BATCHES 100
+#define FRAMES 10000
+
+static int windows[WINDOWS];
+static int render;  /* -egl; plain -null windows have no context */
+static int motions, displays, batches, frames;
+static GLUTnanoseconds start, motionTime;
+
+static void
+injectBatch(void)
+{
+  int i;
+
+  for (i = 0; i < BATCH; i++) {
+    glutInjectMotion(windows[i % WINDOWS], i & 255, i >> 8);
+  }
+  glutInjectKeyboard(windows[0], ' ', GLUT_DOWN, 0, 0);
+}
+
+static void
+display(void)
+{
+  if (render) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    glutSwapBuffers();
+  }
+  displays++;
+}
+
+static void
+passive(int x, int y)
+{
+  motions++;
+}
+
+static void
+redisplayAll(void)
+{
+  int i;
+
+  if (frames++ == FRAMES) {
+    GLUTnanoseconds redisplayTime = glutGetNanoseconds() - start;
+
+    printf("%d windows: %.1f ns per motion event, %.1f ns per redisplay\n",
+      WINDOWS, (double) motionTime / (BATCH * BATCHES),
+      (double) redisplayTime / ((double) FRAMES * WINDOWS));
+    if (motions != BATCH * BATCHES || displays < FRAMES * WINDOWS) {
+      printf("FAILED: %d motions, %d redisplays\n", motions, displays);
+      exit(1);
+    }
+    exit(0);
+  }
+  for (i = 0; i < WINDOWS; i++) {
+    glutPostWindowRedisplay(windows[i]);
+  }
+}
+
+static void
+keyboard(unsigned char key, int x, int y)
+{
+  if (++batches < BATCHES) {
+    injectBatch();
+    return;
+  }
+  motionTime = glutGetNanoseconds() - start;
+  displays = 0;
+  start = glutGetNanoseconds();
+  glutIdleFunc(redisplayAll);
+}
+
+static void
+begin(int value)
+{
+  start = glutGetNanoseconds();
+  injectBatch();
+}
+
+int
+main(int argc, char **argv)
+{
+  char *args[2];
+  int i, nargs = 2;
+
+  args[0] = argv[0];
+  render = argc > 1 && !strcmp(argv[1], "-egl");
+  args[1] = render ? "-egl" : "-null";
+  glutInit(&nargs, args);
+  for (i = 0; i < WINDOWS; i++) {
+    windows[i] = glutCreateWindow("null");
+    glutDisplayFunc(display);
+    glutPassiveMotionFunc(passive);
+  }
+  glutSetWindow(windows[0]);
+  glutKeyboardFunc(keyboard);
+  /* Let the windows map and reshape first. */
+  glutTimerFunc(1, begin, 0);
+  glutMainLoop();
+  return 0;
+}
+#endif /* TEST */
@@ -330,6 +330,7 @@ __glutFreeOverlay(GLUToverlay * overlay)
   if (overlay->visAlloced) {
     XFree(overlay->vis);
   }
+  __glutUnhashWindow(overlay->win);
   XDestroyWindow(__glutDisplay, overlay->win);
   glXDestroyContext(__glutDisplay, overlay->ctx);
   if (overlay->colormap) {
@@ -342,6 +343,12 @@ __glutFreeOverlay(GLUToverlay * overlay)
 static XVisualInfo *
 determineOverlayVisual(int *treatAsSingle, Bool * visAlloced, void **fbc)
 {
+  if (__glutNullWindowSystem) {
+    /* The null window system has no overlay planes. */
+    *visAlloced = False;
+    *fbc = NULL;
+    return NULL;
+  }
   if (__glutDisplayString) {
     XVisualInfo *vi;
     int i;
@@ -467,6 +474,7 @@ glutEstablishOverlay(void)
     overlay->vis->depth, InputOutput, overlay->vis->visual,
     CWBackPixel | CWBorderPixel | CWEventMask | CWColormap,
     &wa);
+  __glutHashWindow(overlay->win, window);
 #endif
   if (window->children) {
     /* Overlay window must be lowered below any GLUT
@@ -30,6 +30,10 @@ glutSwapBuffers(void)
   /* For the MESA_SWAP_HACK. */
   window->usedSwapBuffers = 1;
 
+  if (__glutNullWindowSystem && !__glutUseEGL) {
+    /* No buffers to swap. */
+    return;
+  }
   SWAP_BUFFERS_LAYER(__glutCurrentWindow);
 
   /* I considered putting the window being swapped on the
@@ -0,0 +1,514 @@
+
+/* Copyright (c) Mark J. Kilgard, 2026. */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* GLUT timers.  Pending timers form a binary min-heap ordered by
+   deadline, ties going to the timer scheduled first, so
+   scheduling, cancelling, and rescheduling each cost O(log n)
+   however many timers an application keeps.  Every timer also
+   owns a slot in timerTable, which is how the id handed back by
+   glutScheduleTimer finds it again in O(1).  An id packs the slot
+   with a count of the slot's reuses, so the id of a timer that
+   has fired or been cancelled does not match whatever timer now
+   occupies its slot.
+
+   A timer with slack may fire up to that much after its deadline,
+   so the main loop can sleep until a later timer is due as well
+   and serve both with one wakeup.  How late timers actually fire
+   is tallied for glutGetTimerLateness. */
+
+#include <stdlib.h>
+
+#include "glutint.h"
+
+#define SLOT_BITS 20
+#define SLOT_MASK ((1 << SLOT_BITS) - 1)
+#define MAX_SLOTS SLOT_MASK   /* ids store slot + 1 */
+#define REUSE_MASK 0x7ff      /* keeps ids positive */
+
+/* GLUT inter-file variables */
+GLUTtimer **__glutTimerHeap = NULL;
+int __glutTimerCount = 0;
+GLUTtimer *__glutCurrentTimer = NULL;
+#ifdef SUPPORT_FORTRAN
+GLUTtimer *__glutNewTimer;
+#endif
+
+static GLUTtimer **timerTable = NULL;
+static int timerTableSize = 0;
+static int timerTableCapacity = 0;
+static int timerHeapSize = 0;
+static GLUTtimer *freeTimerList = NULL;
+static unsigned int scheduleCount = 0;
+static int lateCount = 0;
+static GLUTnanoseconds lateTotal = 0;
+static GLUTnanoseconds lateWorst = 0;
+
+static int
+earlier(GLUTtimer * a, GLUTtimer * b)
+{
+  if (a->timeout != b->timeout) {
+    return a->timeout < b->timeout;
+  }
+  /* Scheduling order, allowing for wrap around. */
+  return (int) (a->order - b->order) < 0;
+}
+
+static void
+place(GLUTtimer * timer, int i)
+{
+  __glutTimerHeap[i] = timer;
+  timer->heapIndex = i;
+}
+
+static void
+siftUp(GLUTtimer * timer, int i)
+{
+  while (i > 0) {
+    int parent = (i - 1) / 2;
+
+    if (!earlier(timer, __glutTimerHeap[parent])) {
+      break;
+    }
+    place(__glutTimerHeap[parent], i);
+    i = parent;
+  }
+  place(timer, i);
+}
+
+static void
+siftDown(GLUTtimer * timer, int i)
+{
+  for (;;) {
+    int child = 2 * i + 1;
+
+    if (child >= __glutTimerCount) {
+      break;
+    }
+    if (child + 1 < __glutTimerCount &&
+      earlier(__glutTimerHeap[child + 1], __glutTimerHeap[child])) {
+      child++;
+    }
+    if (!earlier(__glutTimerHeap[child], timer)) {
+      break;
+    }
+    place(__glutTimerHeap[child], i);
+    i = child;
+  }
+  place(timer, i);
+}
+
+static void
+insertTimer(GLUTtimer * timer)
+{
+  if (__glutTimerCount == timerHeapSize) {
+    int size = timerHeapSize ? 2 * timerHeapSize : 16;
+    GLUTtimer **heap = (GLUTtimer **)
+      realloc(__glutTimerHeap, size * sizeof(GLUTtimer *));
+
+    if (!heap) {
+      __glutFatalError("out of memory.");
+    }
+    __glutTimerHeap = heap;
+    timerHeapSize = size;
+  }
+  siftUp(timer, __glutTimerCount++);
+}
+
+static void
+removeTimer(GLUTtimer * timer)
+{
+  int i = timer->heapIndex;
+  GLUTtimer *last = __glutTimerHeap[--__glutTimerCount];
+
+  timer->heapIndex = -1;
+  if (last != timer) {
+    if (i > 0 && earlier(last, __glutTimerHeap[(i - 1) / 2])) {
+      siftUp(last, i);
+    } else {
+      siftDown(last, i);
+    }
+  }
+}
+
+/* Changes a pending or firing timer's deadline. */
+static void
+moveTimer(GLUTtimer * timer, GLUTnanoseconds timeout)
+{
+  timer->timeout = timeout;
+  timer->order = scheduleCount++;
+  if (timer->heapIndex < 0) {
+    insertTimer(timer);
+  } else {
+    /* A later order can only move it down, but an earlier
+       deadline can move it up. */
+    siftUp(timer, timer->heapIndex);
+    siftDown(timer, timer->heapIndex);
+  }
+}
+
+static GLUTtimer *
+newTimer(void)
+{
+  GLUTtimer *timer;
+
+  if (freeTimerList) {
+    timer = freeTimerList;
+    freeTimerList = timer->next;
+    timer->id = ((((unsigned int) timer->id >> SLOT_BITS) + 1) & REUSE_MASK)
+      << SLOT_BITS | (timer->slot + 1);
+    return timer;
+  }
+  if (timerTableSize == MAX_SLOTS) {
+    __glutFatalError("too many timers.");
+  }
+  if (timerTableSize == timerTableCapacity) {
+    int size = timerTableCapacity ? 2 * timerTableCapacity : 16;
+    GLUTtimer **table = (GLUTtimer **)
+      realloc(timerTable, size * sizeof(GLUTtimer *));
+
+    if (!table) {
+      __glutFatalError("out of memory.");
+    }
+    timerTable = table;
+    timerTableCapacity = size;
+  }
+  timer = (GLUTtimer *) malloc(sizeof(GLUTtimer));
+  if (!timer) {
+    __glutFatalError("out of memory.");
+  }
+  timer->slot = timerTableSize;
+  timer->id = timer->slot + 1;
+  timer->heapIndex = -1;
+  timerTable[timerTableSize++] = timer;
+  return timer;
+}
+
+/* The timer an id names, if it is pending or firing. */
+static GLUTtimer *
+findTimer(int id)
+{
+  int slot = (id & SLOT_MASK) - 1;
+  GLUTtimer *timer;
+
+  if (id <= 0 || slot < 0 || slot >= timerTableSize) {
+    return NULL;
+  }
+  timer = timerTable[slot];
+  if (timer->id != id ||
+    (timer->heapIndex < 0 && timer != __glutCurrentTimer)) {
+    return NULL;
+  }
+  return timer;
+}
+
+int
+__glutScheduleTimer(GLUTnanoseconds timeout, GLUTnanoseconds slack,
+  GLUTtimerCB timerFunc, int value)
+{
+  GLUTtimer *timer = newTimer();
+
+  timer->slack = slack;
+  timer->func = timerFunc;
+  timer->value = value;
+#ifdef SUPPORT_FORTRAN
+  __glutNewTimer = timer;  /* for Fortran binding! */
+#endif
+  moveTimer(timer, timeout);
+  return timer->id;
+}
+
+/* When the main loop must wake for the earliest timer: as late as
+   its slack allows, but no later than the next timer's deadline,
+   since every other timer is due no sooner than that. */
+GLUTnanoseconds
+__glutTimerDeadline(void)
+{
+  GLUTtimer *first = __glutTimerHeap[0];
+  GLUTnanoseconds deadline = first->timeout + first->slack;
+  int i;
+
+  if (deadline < first->timeout) {
+    deadline = GLUT_WAIT_FOREVER;  /* slack past the end of time */
+  }
+  for (i = 1; i <= 2 && i < __glutTimerCount; i++) {
+    if (__glutTimerHeap[i]->timeout < deadline) {
+      deadline = __glutTimerHeap[i]->timeout;
+    }
+  }
+  return deadline;
+}
+
+/* Only timers scheduled before the pass began fire in it: one a
+   callback schedules, even with a zero interval, waits for the next
+   pass instead of starving event processing.  Reading the clock
+   once is not enough, since a virtual or program clock may not
+   move between passes. */
+void
+__glutHandleTimeouts(void)
+{
+  GLUTnanoseconds now = __glutClockNow();
+  unsigned int passOrder = scheduleCount;
+  GLUTtimer *timer;
+
+  while (__glutTimerCount && __glutTimerHeap[0]->timeout <= now &&
+    (int) (__glutTimerHeap[0]->order - passOrder) < 0) {
+    timer = __glutTimerHeap[0];
+    removeTimer(timer);
+    if (now - timer->timeout > lateWorst) {
+      lateWorst = now - timer->timeout;
+    }
+    lateTotal += now - timer->timeout;
+    lateCount++;
+    __glutCurrentTimer = timer;
+    timer->func(timer->value);
+    __glutCurrentTimer = NULL;
+    /* Unless the callback rescheduled it. */
+    if (timer->heapIndex < 0) {
+      timer->next = freeTimerList;
+      freeTimerList = timer;
+    }
+  }
+}
+
+/* CENTRY */
+void GLUTAPIENTRY
+glutTimerFunc(unsigned int interval, GLUTtimerCB timerFunc, int value)
+{
+  glutScheduleTimer(interval, timerFunc, value);
+}
+
+int GLUTAPIENTRY
+glutScheduleTimer(unsigned int interval, GLUTtimerCB timerFunc, int value)
+{
+  if (!timerFunc) {
+    return 0;
+  }
+  return __glutScheduleTimer(
+    __glutClockNow() + (GLUTnanoseconds) interval * 1000000, 0,
+    timerFunc, value);
+}
+
+int GLUTAPIENTRY
+glutScheduleTimerAt(GLUTnanoseconds deadline, GLUTnanoseconds slack,
+  GLUTtimerCB timerFunc, int value)
+{
+  if (!timerFunc) {
+    return 0;
+  }
+  return __glutScheduleTimer(__glutClockGenesis() + deadline, slack,
+    timerFunc, value);
+}
+
+int GLUTAPIENTRY
+glutCancelTimer(int id)
+{
+  GLUTtimer *timer = findTimer(id);
+
+  if (!timer || timer->heapIndex < 0) {
+    return 0;
+  }
+  removeTimer(timer);
+  if (timer != __glutCurrentTimer) {
+    timer->next = freeTimerList;
+    freeTimerList = timer;
+  }
+  return 1;
+}
+
+int GLUTAPIENTRY
+glutRescheduleTimer(int id, unsigned int interval)
+{
+  GLUTtimer *timer = findTimer(id);
+
+  if (!timer) {
+    return 0;
+  }
+  moveTimer(timer,
+    __glutClockNow() + (GLUTnanoseconds) interval * 1000000);
+  return 1;
+}
+
+int GLUTAPIENTRY
+glutRescheduleTimerAt(int id, GLUTnanoseconds deadline)
+{
+  GLUTtimer *timer = findTimer(id);
+
+  if (!timer) {
+    return 0;
+  }
+  moveTimer(timer, __glutClockGenesis() + deadline);
+  return 1;
+}
+
+int GLUTAPIENTRY
+glutGetTimerLateness(GLUTnanoseconds * mean, GLUTnanoseconds * worst,
+  int reset)
+{
+  int count = lateCount;
+
+  if (mean) {
+    *mean = count ? lateTotal / count : 0;
+  }
+  if (worst) {
+    *worst = lateWorst;
+  }
+  if (reset) {
+    lateCount = 0;
+    lateTotal = 0;
+    lateWorst = 0;
+  }
+  return count;
+}
+/* ENDCENTRY */
+
+#ifdef TEST
+
+/* Microbenchmark: times each operation on TIMERS timers against
+   the sorted list glutTimerFunc used to keep, then measures how
+   late the main loop's wait fires a timer paced every PERIOD. */
+
+#include <stdio.h>
+
+#define TIMERS 10000
+#define PERIOD 1000000  /* 1 millisecond */
+#define PACED 500
+
+char *__glutProgramName = "timer";  /* normally glut_init.c's */
+Display *__glutDisplay = NULL;
+int __glutConnectionFD = -1;
+GLUTwindow **__glutWindowList = NULL;  /* glut_win.c's, for glut_watch.o */
+int __glutWindowListSize = 0;
+static int fired, rearmed;
+static int paceTimer, paced;
+static GLUTnanoseconds paceDeadline;
+
+static void GLUTCALLBACK
+countFire(int value)
+{
+  fired += value;
+}
+
+static void GLUTCALLBACK
+paceFire(int value)
+{
+  if (++paced < PACED) {
+    paceDeadline += PERIOD;
+    glutRescheduleTimerAt(paceTimer, paceDeadline);
+  }
+}
+
+void
+__glutPostRedisplay(GLUTwindow * window, int layerMask)
+{
+}
+
+static void GLUTCALLBACK
+rearmFire(int value)
+{
+  /* Bounded, so a pass that never ends still fails. */
+  if (++rearmed < 1000) {
+    glutTimerFunc(0, rearmFire, value);
+  }
+}
+
+static void
+report(const char *what, GLUTnanoseconds start, int count)
+{
+  printf("%-32s %8.1f ns each\n", what,
+    (double) (__glutClockNow() - start) / count);
+}
+
+typedef struct _ListTimer ListTimer;
+struct _ListTimer {
+  ListTimer *next;
+  GLUTnanoseconds timeout;
+};
+
+int
+main(int argc, char **argv)
+{
+  static int id[TIMERS];
+  static ListTimer node[TIMERS];
+  ListTimer *list = NULL;
+  GLUTnanoseconds start, mean, worst;
+  int i;
+
+  __glutInitClock(0);
+  __glutProgramName = argv[0];
+  srand(1);
+
+  start = __glutClockNow();
+  for (i = 0; i < TIMERS; i++) {
+    ListTimer **prevptr = &list;
+
+    node[i].timeout = start + (GLUTnanoseconds) (rand() % 1000 + 1000) * 1000000;
+    while (*prevptr && node[i].timeout > (*prevptr)->timeout) {
+      prevptr = &(*prevptr)->next;
+    }
+    node[i].next = *prevptr;
+    *prevptr = &node[i];
+  }
+  report("sorted list insert", start, TIMERS);
+
+  start = __glutClockNow();
+  for (i = 0; i < TIMERS; i++) {
+    id[i] = glutScheduleTimer(rand() % 1000 + 1000, countFire, 1);
+  }
+  report("glutScheduleTimer", start, TIMERS);
+
+  start = __glutClockNow();
+  for (i = 0; i < TIMERS; i++) {
+    glutRescheduleTimer(id[i], rand() % 1000 + 1000);
+  }
+  report("glutRescheduleTimer", start, TIMERS);
+
+  start = __glutClockNow();
+  for (i = 0; i < TIMERS; i += 2) {
+    glutCancelTimer(id[i]);
+  }
+  report("glutCancelTimer", start, TIMERS / 2);
+
+  /* Pull the rest forward so they all expire at once. */
+  for (i = 1; i < TIMERS; i += 2) {
+    glutRescheduleTimer(id[i], 0);
+  }
+  start = __glutClockNow();
+  __glutHandleTimeouts();
+  report("expire in one pass", start, TIMERS / 2);
+
+  if (fired != TIMERS / 2 || __glutTimerCount != 0 ||
+    glutCancelTimer(id[0]) || glutRescheduleTimer(id[1], 0)) {
+    printf("FAILED: %d fired, %d pending\n", fired, __glutTimerCount);
+    return 1;
+  }
+
+  (void) glutGetTimerLateness(NULL, NULL, 1);
+  paceDeadline = glutGetNanoseconds() + PERIOD;
+  paceTimer = glutScheduleTimerAt(paceDeadline, 0, paceFire, 0);
+  while (__glutTimerCount) {
+    (void) __glutWaitForEvents(__glutTimerDeadline());
+    __glutHandleTimeouts();
+  }
+  i = glutGetTimerLateness(&mean, &worst, 0);
+  printf("%d paced wakeups %8.1f us mean lateness, %.1f us worst\n",
+    i, mean / 1000.0, worst / 1000.0);
+
+  /* With time standing still, a timer re-arming itself with a zero
+     interval must still fire once per pass. */
+  __glutInitClock(GLUT_CLOCK_VIRTUAL);
+  glutTimerFunc(0, rearmFire, 0);
+  for (i = 0; i < 3; i++) {
+    __glutHandleTimeouts();
+  }
+  if (rearmed != 3) {
+    printf("FAILED: zero interval timer fired %d times in 3 passes\n",
+      rearmed);
+    return 1;
+  }
+  return 0;
+}
+#endif /* TEST */
@@ -1,1776 +1,623 @@
 
 /* GENERATED FILE -- DO NOT MODIFY */
 
-#define glutBitmapTimesRoman10 XXX
-#include "glutbitmap.h"
-#undef glutBitmapTimesRoman10
-
-/* char: 0xff */
-
-static const GLubyte ch255data[] = {
-0x80,0xc0,0x40,0x60,0xa0,0x90,0xb8,0x0,0xa0,
-};
-
-static const BitmapCharRec ch255 = {5,9,0,2,5,ch255data};
-
-/* char: 0xfe */
-
-static const GLubyte ch254data[] = {
-0xc0,0x80,0xe0,0x90,0x90,0x90,0xe0,0x80,0x80,
-};
-
-static const BitmapCharRec ch254 = {4,9,0,2,5,ch254data};
-
-/* char: 0xfd */
-
-static const GLubyte ch253data[] = {
-0x80,0xc0,0x40,0x60,0xa0,0x90,0xb8,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch253 = {5,10,0,2,5,ch253data};
-
-/* char: 0xfc */
-
-static const GLubyte ch252data[] = {
-0x68,0x90,0x90,0x90,0x90,0x0,0x50,
-};
-
-static const BitmapCharRec ch252 = {5,7,0,0,5,ch252data};
-
-/* char: 0xfb */
-
-static const GLubyte ch251data[] = {
-0x68,0x90,0x90,0x90,0x90,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch251 = {5,8,0,0,5,ch251data};
-
-/* char: 0xfa */
-
-static const GLubyte ch250data[] = {
-0x68,0x90,0x90,0x90,0x90,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch250 = {5,8,0,0,5,ch250data};
-
-/* char: 0xf9 */
-
-static const GLubyte ch249data[] = {
-0x68,0x90,0x90,0x90,0x90,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch249 = {5,8,0,0,5,ch249data};
-
-/* char: 0xf8 */
-
-static const GLubyte ch248data[] = {
-0x80,0x70,0x48,0x48,0x48,0x38,0x4,
-};
-
-static const BitmapCharRec ch248 = {6,7,1,1,5,ch248data};
-
-/* char: 0xf7 */
-
-static const GLubyte ch247data[] = {
-0x20,0x0,0xf8,0x0,0x20,
-};
-
-static const BitmapCharRec ch247 = {5,5,0,0,6,ch247data};
-
-/* char: 0xf6 */
-
-static const GLubyte ch246data[] = {
-0x60,0x90,0x90,0x90,0x60,0x0,0xa0,
-};
-
-static const BitmapCharRec ch246 = {4,7,0,0,5,ch246data};
-
-/* char: 0xf5 */
-
-static const GLubyte ch245data[] = {
-0x60,0x90,0x90,0x90,0x60,0x0,0xa0,0x50,
-};
-
-static const BitmapCharRec ch245 = {4,8,0,0,5,ch245data};
-
-/* char: 0xf4 */
-
-static const GLubyte ch244data[] = {
-0x60,0x90,0x90,0x90,0x60,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch244 = {4,8,0,0,5,ch244data};
-
-/* char: 0xf3 */
-
-static const GLubyte ch243data[] = {
-0x60,0x90,0x90,0x90,0x60,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch243 = {4,8,0,0,5,ch243data};
-
-/* char: 0xf2 */
-
-static const GLubyte ch242data[] = {
-0x60,0x90,0x90,0x90,0x60,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch242 = {4,8,0,0,5,ch242data};
-
-/* char: 0xf1 */
-
-static const GLubyte ch241data[] = {
-0xd8,0x90,0x90,0x90,0xe0,0x0,0xa0,0x50,
-};
-
-static const BitmapCharRec ch241 = {5,8,0,0,5,ch241data};
-
-/* char: 0xf0 */
-
-static const GLubyte ch240data[] = {
-0x60,0x90,0x90,0x90,0x70,0xa0,0x70,0x40,
-};
-
-static const BitmapCharRec ch240 = {4,8,0,0,5,ch240data};
-
-/* char: 0xef */
-
-static const GLubyte ch239data[] = {
-0xe0,0x40,0x40,0x40,0xc0,0x0,0xa0,
-};
-
-static const BitmapCharRec ch239 = {3,7,0,0,4,ch239data};
-
-/* char: 0xee */
-
-static const GLubyte ch238data[] = {
-0xe0,0x40,0x40,0x40,0xc0,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch238 = {3,8,0,0,4,ch238data};
-
-/* char: 0xed */
-
-static const GLubyte ch237data[] = {
-0xe0,0x40,0x40,0x40,0xc0,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch237 = {3,8,0,0,4,ch237data};
-
-/* char: 0xec */
-
-static const GLubyte ch236data[] = {
-0xe0,0x40,0x40,0x40,0xc0,0x0,0x40,0x80,
-};
-
-static const BitmapCharRec ch236 = {3,8,0,0,4,ch236data};
-
-/* char: 0xeb */
-
-static const GLubyte ch235data[] = {
-0x60,0x80,0xc0,0xa0,0x60,0x0,0xa0,
-};
-
-static const BitmapCharRec ch235 = {3,7,0,0,4,ch235data};
-
-/* char: 0xea */
-
-static const GLubyte ch234data[] = {
-0x60,0x80,0xc0,0xa0,0x60,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch234 = {3,8,0,0,4,ch234data};
-
-/* char: 0xe9 */
-
-static const GLubyte ch233data[] = {
-0x60,0x80,0xc0,0xa0,0x60,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch233 = {3,8,0,0,4,ch233data};
-
-/* char: 0xe8 */
-
-static const GLubyte ch232data[] = {
-0x60,0x80,0xc0,0xa0,0x60,0x0,0x40,0x80,
-};
-
-static const BitmapCharRec ch232 = {3,8,0,0,4,ch232data};
-
-/* char: 0xe7 */
-
-static const GLubyte ch231data[] = {
-0xc0,0x20,0x40,0x60,0x80,0x80,0x80,0x60,
-};
-
-static const BitmapCharRec ch231 = {3,8,0,3,4,ch231data};
-
-/* char: 0xe6 */
-
-static const GLubyte ch230data[] = {
-0xd8,0xa0,0x70,0x28,0xd8,
-};
-
-static const BitmapCharRec ch230 = {5,5,0,0,6,ch230data};
-
-/* char: 0xe5 */
-
-static const GLubyte ch229data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,0x40,0xa0,0x40,
-};
-
-static const BitmapCharRec ch229 = {3,8,0,0,4,ch229data};
-
-/* char: 0xe4 */
-
-static const GLubyte ch228data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,0x0,0xa0,
-};
-
-static const BitmapCharRec ch228 = {3,7,0,0,4,ch228data};
-
-/* char: 0xe3 */
-
-static const GLubyte ch227data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,0x0,0xa0,0x50,
-};
-
-static const BitmapCharRec ch227 = {4,8,0,0,4,ch227data};
-
-/* char: 0xe2 */
-
-static const GLubyte ch226data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch226 = {3,8,0,0,4,ch226data};
-
-/* char: 0xe1 */
-
-static const GLubyte ch225data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch225 = {3,8,0,0,4,ch225data};
-
-/* char: 0xe0 */
-
-static const GLubyte ch224data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,0x0,0x40,0x80,
-};
-
-static const BitmapCharRec ch224 = {3,8,0,0,4,ch224data};
-
-/* char: 0xdf */
-
-static const GLubyte ch223data[] = {
-0xe0,0x50,0x50,0x60,0x50,0x50,0x20,
-};
-
-static const BitmapCharRec ch223 = {4,7,0,0,5,ch223data};
-
-/* char: 0xde */
-
-static const GLubyte ch222data[] = {
-0xe0,0x40,0x70,0x48,0x70,0x40,0xe0,
-};
-
-static const BitmapCharRec ch222 = {5,7,0,0,6,ch222data};
-
-/* char: 0xdd */
-
-static const GLubyte ch221data[] = {
-0x38,0x10,0x10,0x28,0x28,0x44,0xee,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch221 = {7,10,0,0,8,ch221data};
-
-/* char: 0xdc */
-
-static const GLubyte ch220data[] = {
-0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x28,
-};
-
-static const BitmapCharRec ch220 = {7,9,0,0,8,ch220data};
-
-/* char: 0xdb */
-
-static const GLubyte ch219data[] = {
-0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x28,0x10,
-};
-
-static const BitmapCharRec ch219 = {7,10,0,0,8,ch219data};
-
-/* char: 0xda */
-
-static const GLubyte ch218data[] = {
-0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch218 = {7,10,0,0,8,ch218data};
-
-/* char: 0xd9 */
-
-static const GLubyte ch217data[] = {
-0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x10,0x20,
-};
-
-static const BitmapCharRec ch217 = {7,10,0,0,8,ch217data};
-
-/* char: 0xd8 */
-
-static const GLubyte ch216data[] = {
-0x80,0x7c,0x66,0x52,0x52,0x4a,0x66,0x3e,0x1,
-};
-
-static const BitmapCharRec ch216 = {8,9,0,1,8,ch216data};
-
-/* char: 0xd7 */
-
-static const GLubyte ch215data[] = {
-0x88,0x50,0x20,0x50,0x88,
-};
-
-static const BitmapCharRec ch215 = {5,5,0,0,6,ch215data};
-
-/* char: 0xd6 */
-
-static const GLubyte ch214data[] = {
-0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x50,
-};
-
-static const BitmapCharRec ch214 = {6,9,0,0,7,ch214data};
-
-/* char: 0xd5 */
-
-static const GLubyte ch213data[] = {
-0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x50,0x28,
-};
-
-static const BitmapCharRec ch213 = {6,10,0,0,7,ch213data};
-
-/* char: 0xd4 */
-
-static const GLubyte ch212data[] = {
-0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch212 = {6,10,0,0,7,ch212data};
-
-/* char: 0xd3 */
-
-static const GLubyte ch211data[] = {
-0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch211 = {6,10,0,0,7,ch211data};
-
-/* char: 0xd2 */
-
-static const GLubyte ch210data[] = {
-0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch210 = {6,10,0,0,7,ch210data};
-
-/* char: 0xd1 */
-
-static const GLubyte ch209data[] = {
-0xe4,0x4c,0x4c,0x54,0x54,0x64,0xee,0x0,0x50,0x28,
-};
-
-static const BitmapCharRec ch209 = {7,10,0,0,8,ch209data};
-
-/* char: 0xd0 */
-
-static const GLubyte ch208data[] = {
-0xf8,0x4c,0x44,0xe4,0x44,0x4c,0xf8,
-};
-
-static const BitmapCharRec ch208 = {6,7,0,0,7,ch208data};
-
-/* char: 0xcf */
-
-static const GLubyte ch207data[] = {
-0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0xa0,
-};
-
-static const BitmapCharRec ch207 = {3,9,0,0,4,ch207data};
-
-/* char: 0xce */
-
-static const GLubyte ch206data[] = {
-0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch206 = {3,10,0,0,4,ch206data};
-
-/* char: 0xcd */
-
-static const GLubyte ch205data[] = {
-0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0x40,0x20,
-};
-
-static const BitmapCharRec ch205 = {3,10,0,0,4,ch205data};
-
-/* char: 0xcc */
-
-static const GLubyte ch204data[] = {
-0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0x40,0x80,
-};
-
-static const BitmapCharRec ch204 = {3,10,0,0,4,ch204data};
-
-/* char: 0xcb */
-
-static const GLubyte ch203data[] = {
-0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x50,
-};
-
-static const BitmapCharRec ch203 = {5,9,0,0,6,ch203data};
-
-/* char: 0xca */
-
-static const GLubyte ch202data[] = {
-0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x50,0x20,
-};
-
-static const BitmapCharRec ch202 = {5,10,0,0,6,ch202data};
-
-/* char: 0xc9 */
-
-static const GLubyte ch201data[] = {
-0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x20,0x10,
-};
-
-static const BitmapCharRec ch201 = {5,10,0,0,6,ch201data};
-
-/* char: 0xc8 */
-
-static const GLubyte ch200data[] = {
-0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x20,0x40,
-};
-
-static const BitmapCharRec ch200 = {5,10,0,0,6,ch200data};
-
-/* char: 0xc7 */
-
-static const GLubyte ch199data[] = {
-0x60,0x10,0x20,0x78,0xc4,0x80,0x80,0x80,0xc4,0x7c,
-};
-
-static const BitmapCharRec ch199 = {6,10,0,3,7,ch199data};
-
-/* char: 0xc6 */
-
-static const GLubyte ch198data[] = {
-0xef,0x49,0x78,0x2e,0x28,0x39,0x1f,
-};
-
-static const BitmapCharRec ch198 = {8,7,0,0,9,ch198data};
-
-/* char: 0xc5 */
-
-static const GLubyte ch197data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x10,0x28,0x10,
-};
-
-static const BitmapCharRec ch197 = {7,10,0,0,8,ch197data};
-
-/* char: 0xc4 */
-
-static const GLubyte ch196data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x28,
-};
-
-static const BitmapCharRec ch196 = {7,9,0,0,8,ch196data};
-
-/* char: 0xc3 */
-
-static const GLubyte ch195data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x28,0x14,
-};
-
-static const BitmapCharRec ch195 = {7,10,0,0,8,ch195data};
-
-/* char: 0xc2 */
-
-static const GLubyte ch194data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x28,0x10,
-};
-
-static const BitmapCharRec ch194 = {7,10,0,0,8,ch194data};
-
-/* char: 0xc1 */
-
-static const GLubyte ch193data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x10,0x8,
-};
-
-static const BitmapCharRec ch193 = {7,10,0,0,8,ch193data};
-
-/* char: 0xc0 */
-
-static const GLubyte ch192data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x10,0x20,
-};
-
-static const BitmapCharRec ch192 = {7,10,0,0,8,ch192data};
-
-/* char: 0xbf */
-
-static const GLubyte ch191data[] = {
-0xe0,0xa0,0x80,0x40,0x40,0x0,0x40,
-};
-
-static const BitmapCharRec ch191 = {3,7,0,2,4,ch191data};
-
-/* char: 0xbe */
-
-static const GLubyte ch190data[] = {
-0x44,0x3e,0x2c,0xd4,0x28,0x48,0xe4,
-};
-
-static const BitmapCharRec ch190 = {7,7,0,0,8,ch190data};
-
-/* char: 0xbd */
-
-static const GLubyte ch189data[] = {
-0x4e,0x24,0x2a,0xf6,0x48,0xc8,0x44,
-};
-
-static const BitmapCharRec ch189 = {7,7,0,0,8,ch189data};
-
-/* char: 0xbc */
-
-static const GLubyte ch188data[] = {
-0x44,0x3e,0x2c,0xf4,0x48,0xc8,0x44,
-};
-
-static const BitmapCharRec ch188 = {7,7,0,0,8,ch188data};
-
-/* char: 0xbb */
-
-static const GLubyte ch187data[] = {
-0xa0,0x50,0x50,0xa0,
-};
-
-static const BitmapCharRec ch187 = {4,4,0,-1,5,ch187data};
-
-/* char: 0xba */
-
-static const GLubyte ch186data[] = {
-0xe0,0x0,0x40,0xa0,0x40,
-};
-
-static const BitmapCharRec ch186 = {3,5,0,-2,4,ch186data};
-
-/* char: 0xb9 */
-
-static const GLubyte ch185data[] = {
-0xe0,0x40,0xc0,0x40,
-};
-
-static const BitmapCharRec ch185 = {3,4,0,-3,3,ch185data};
-
-/* char: 0xb8 */
-
-static const GLubyte ch184data[] = {
-0xc0,0x20,0x40,
-};
-
-static const BitmapCharRec ch184 = {3,3,0,3,4,ch184data};
-
-/* char: 0xb7 */
-
-static const GLubyte ch183data[] = {
-0x80,
-};
-
-static const BitmapCharRec ch183 = {1,1,0,-2,2,ch183data};
-
-/* char: 0xb6 */
-
-static const GLubyte ch182data[] = {
-0x28,0x28,0x28,0x28,0x68,0xe8,0xe8,0xe8,0x7c,
-};
-
-static const BitmapCharRec ch182 = {6,9,0,2,6,ch182data};
-
-/* char: 0xb5 */
-
-static const GLubyte ch181data[] = {
-0x80,0x80,0xe8,0x90,0x90,0x90,0x90,
-};
-
-static const BitmapCharRec ch181 = {5,7,0,2,5,ch181data};
-
-/* char: 0xb4 */
-
-static const GLubyte ch180data[] = {
-0x80,0x40,
-};
-
-static const BitmapCharRec ch180 = {2,2,0,-5,3,ch180data};
-
-/* char: 0xb3 */
-
-static const GLubyte ch179data[] = {
-0xc0,0x20,0x40,0xe0,
-};
-
-static const BitmapCharRec ch179 = {3,4,0,-3,3,ch179data};
-
-/* char: 0xb2 */
-
-static const GLubyte ch178data[] = {
-0xe0,0x40,0xa0,0x60,
-};
-
-static const BitmapCharRec ch178 = {3,4,0,-3,3,ch178data};
-
-/* char: 0xb1 */
-
-static const GLubyte ch177data[] = {
-0xf8,0x0,0x20,0x20,0xf8,0x20,0x20,
-};
-
-static const BitmapCharRec ch177 = {5,7,0,0,6,ch177data};
-
-/* char: 0xb0 */
-
-static const GLubyte ch176data[] = {
-0x60,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch176 = {4,4,0,-3,4,ch176data};
-
-/* char: 0xaf */
-
-static const GLubyte ch175data[] = {
-0xe0,
-};
-
-static const BitmapCharRec ch175 = {3,1,0,-6,4,ch175data};
-
-/* char: 0xae */
-
-static const GLubyte ch174data[] = {
-0x38,0x44,0xaa,0xb2,0xba,0x44,0x38,
-};
-
-static const BitmapCharRec ch174 = {7,7,-1,0,9,ch174data};
-
-/* char: 0xad */
-
-static const GLubyte ch173data[] = {
-0xe0,
-};
-
-static const BitmapCharRec ch173 = {3,1,0,-2,4,ch173data};
-
-/* char: 0xac */
-
-static const GLubyte ch172data[] = {
-0x8,0x8,0xf8,
-};
-
-static const BitmapCharRec ch172 = {5,3,-1,-1,7,ch172data};
-
-/* char: 0xab */
-
-static const GLubyte ch171data[] = {
-0x50,0xa0,0xa0,0x50,
-};
-
-static const BitmapCharRec ch171 = {4,4,0,-1,5,ch171data};
-
-/* char: 0xaa */
-
-static const GLubyte ch170data[] = {
-0xe0,0x0,0xa0,0x20,0xc0,
-};
-
-static const BitmapCharRec ch170 = {3,5,0,-2,4,ch170data};
-
-/* char: 0xa9 */
-
-static const GLubyte ch169data[] = {
-0x38,0x44,0x9a,0xa2,0x9a,0x44,0x38,
-};
-
-static const BitmapCharRec ch169 = {7,7,-1,0,9,ch169data};
-
-/* char: 0xa8 */
-
-static const GLubyte ch168data[] = {
-0xa0,
-};
-
-static const BitmapCharRec ch168 = {3,1,-1,-6,5,ch168data};
-
-/* char: 0xa7 */
-
-static const GLubyte ch167data[] = {
-0xe0,0x90,0x20,0x50,0x90,0xa0,0x40,0x90,0x70,
-};
-
-static const BitmapCharRec ch167 = {4,9,0,1,5,ch167data};
-
-/* char: 0xa6 */
-
-static const GLubyte ch166data[] = {
-0x80,0x80,0x80,0x0,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch166 = {1,7,0,0,2,ch166data};
-
-/* char: 0xa5 */
-
-static const GLubyte ch165data[] = {
-0x70,0x20,0xf8,0x20,0xd8,0x50,0x88,
-};
-
-static const BitmapCharRec ch165 = {5,7,0,0,5,ch165data};
-
-/* char: 0xa4 */
-
-static const GLubyte ch164data[] = {
-0x88,0x70,0x50,0x50,0x70,0x88,
-};
-
-static const BitmapCharRec ch164 = {5,6,0,-1,5,ch164data};
-
-/* char: 0xa3 */
-
-static const GLubyte ch163data[] = {
-0xf0,0xc8,0x40,0xe0,0x40,0x50,0x30,
-};
-
-static const BitmapCharRec ch163 = {5,7,0,0,5,ch163data};
-
-/* char: 0xa2 */
-
-static const GLubyte ch162data[] = {
-0x80,0xe0,0x90,0x80,0x90,0x70,0x10,
-};
-
-static const BitmapCharRec ch162 = {4,7,0,1,5,ch162data};
-
-/* char: 0xa1 */
-
-static const GLubyte ch161data[] = {
-0x80,0x80,0x80,0x80,0x80,0x0,0x80,
-};
-
-static const BitmapCharRec ch161 = {1,7,-1,2,3,ch161data};
-
-/* char: 0xa0 */
-
-#ifdef _WIN32
-/* XXX Work around Microsoft OpenGL 1.1 bug where glBitmap with
-   a height or width of zero does not advance the raster position
-   as specified by OpenGL. (Cosmo OpenGL does not have this bug.) */
-static const GLubyte ch160data[] = { 0x0 };
-static const BitmapCharRec ch160 = {1,1,0,0,2,ch160data};
-#else
-static const BitmapCharRec ch160 = {0,0,0,0,2,0};
-#endif
-
-/* char: 0x7e '~' */
-
-static const GLubyte ch126data[] = {
-0x98,0x64,
-};
-
-static const BitmapCharRec ch126 = {6,2,0,-2,7,ch126data};
-
-/* char: 0x7d '}' */
-
-static const GLubyte ch125data[] = {
-0x80,0x40,0x40,0x40,0x20,0x40,0x40,0x40,0x80,
-};
-
-static const BitmapCharRec ch125 = {3,9,0,2,4,ch125data};
-
-/* char: 0x7c '|' */
-
-static const GLubyte ch124data[] = {
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch124 = {1,9,0,2,2,ch124data};
-
-/* char: 0x7b '{' */
-
-static const GLubyte ch123data[] = {
-0x20,0x40,0x40,0x40,0x80,0x40,0x40,0x40,0x20,
-};
-
-static const BitmapCharRec ch123 = {3,9,0,2,4,ch123data};
-
-/* char: 0x7a 'z' */
-
-static const GLubyte ch122data[] = {
-0xf0,0x90,0x40,0x20,0xf0,
-};
-
-static const BitmapCharRec ch122 = {4,5,0,0,5,ch122data};
-
-/* char: 0x79 'y' */
-
-static const GLubyte ch121data[] = {
-0x40,0x40,0x20,0x30,0x50,0x48,0xdc,
-};
-
-static const BitmapCharRec ch121 = {6,7,1,2,5,ch121data};
-
-/* char: 0x78 'x' */
-
-static const GLubyte ch120data[] = {
-0xd8,0x50,0x20,0x50,0xd8,
-};
-
-static const BitmapCharRec ch120 = {5,5,0,0,6,ch120data};
-
-/* char: 0x77 'w' */
-
-static const GLubyte ch119data[] = {
-0x28,0x6c,0x54,0x92,0xdb,
-};
-
-static const BitmapCharRec ch119 = {8,5,0,0,8,ch119data};
-
-/* char: 0x76 'v' */
-
-static const GLubyte ch118data[] = {
-0x20,0x60,0x50,0x90,0xd8,
-};
-
-static const BitmapCharRec ch118 = {5,5,0,0,5,ch118data};
-
-/* char: 0x75 'u' */
-
-static const GLubyte ch117data[] = {
-0x68,0x90,0x90,0x90,0x90,
-};
-
-static const BitmapCharRec ch117 = {5,5,0,0,5,ch117data};
-
-/* char: 0x74 't' */
-
-static const GLubyte ch116data[] = {
-0x30,0x40,0x40,0x40,0xe0,0x40,
-};
-
-static const BitmapCharRec ch116 = {4,6,0,0,4,ch116data};
-
-/* char: 0x73 's' */
-
-static const GLubyte ch115data[] = {
-0xe0,0x20,0x60,0x80,0xe0,
-};
-
-static const BitmapCharRec ch115 = {3,5,0,0,4,ch115data};
-
-/* char: 0x72 'r' */
-
-static const GLubyte ch114data[] = {
-0xe0,0x40,0x40,0x60,0xa0,
-};
-
-static const BitmapCharRec ch114 = {3,5,0,0,4,ch114data};
-
-/* char: 0x71 'q' */
-
-static const GLubyte ch113data[] = {
-0x38,0x10,0x70,0x90,0x90,0x90,0x70,
-};
-
-static const BitmapCharRec ch113 = {5,7,0,2,5,ch113data};
-
-/* char: 0x70 'p' */
-
-static const GLubyte ch112data[] = {
-0xc0,0x80,0xe0,0x90,0x90,0x90,0xe0,
-};
-
-static const BitmapCharRec ch112 = {4,7,0,2,5,ch112data};
-
-/* char: 0x6f 'o' */
-
-static const GLubyte ch111data[] = {
-0x60,0x90,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch111 = {4,5,0,0,5,ch111data};
-
-/* char: 0x6e 'n' */
-
-static const GLubyte ch110data[] = {
-0xd8,0x90,0x90,0x90,0xe0,
-};
-
-static const BitmapCharRec ch110 = {5,5,0,0,5,ch110data};
-
-/* char: 0x6d 'm' */
-
-static const GLubyte ch109data[] = {
-0xdb,0x92,0x92,0x92,0xec,
-};
-
-static const BitmapCharRec ch109 = {8,5,0,0,8,ch109data};
-
-/* char: 0x6c 'l' */
-
-static const GLubyte ch108data[] = {
-0xe0,0x40,0x40,0x40,0x40,0x40,0xc0,
-};
-
-static const BitmapCharRec ch108 = {3,7,0,0,4,ch108data};
-
-/* char: 0x6b 'k' */
-
-static const GLubyte ch107data[] = {
-0x98,0x90,0xe0,0xa0,0x90,0x80,0x80,
-};
-
-static const BitmapCharRec ch107 = {5,7,0,0,5,ch107data};
-
-/* char: 0x6a 'j' */
-
-static const GLubyte ch106data[] = {
-0x80,0x40,0x40,0x40,0x40,0x40,0xc0,0x0,0x40,
-};
-
-static const BitmapCharRec ch106 = {2,9,0,2,3,ch106data};
-
-/* char: 0x69 'i' */
-
-static const GLubyte ch105data[] = {
-0x40,0x40,0x40,0x40,0xc0,0x0,0x40,
-};
-
-static const BitmapCharRec ch105 = {2,7,0,0,3,ch105data};
-
-/* char: 0x68 'h' */
-
-static const GLubyte ch104data[] = {
-0xd8,0x90,0x90,0x90,0xe0,0x80,0x80,
-};
-
-static const BitmapCharRec ch104 = {5,7,0,0,5,ch104data};
-
-/* char: 0x67 'g' */
-
-static const GLubyte ch103data[] = {
-0xe0,0x90,0x60,0x40,0xa0,0xa0,0x70,
-};
-
-static const BitmapCharRec ch103 = {4,7,0,2,5,ch103data};
-
-/* char: 0x66 'f' */
-
-static const GLubyte ch102data[] = {
-0xe0,0x40,0x40,0x40,0xe0,0x40,0x30,
-};
-
-static const BitmapCharRec ch102 = {4,7,0,0,4,ch102data};
-
-/* char: 0x65 'e' */
-
-static const GLubyte ch101data[] = {
-0x60,0x80,0xc0,0xa0,0x60,
-};
-
-static const BitmapCharRec ch101 = {3,5,0,0,4,ch101data};
-
-/* char: 0x64 'd' */
-
-static const GLubyte ch100data[] = {
-0x68,0x90,0x90,0x90,0x70,0x10,0x30,
-};
-
-static const BitmapCharRec ch100 = {5,7,0,0,5,ch100data};
-
-/* char: 0x63 'c' */
-
-static const GLubyte ch99data[] = {
-0x60,0x80,0x80,0x80,0x60,
-};
-
-static const BitmapCharRec ch99 = {3,5,0,0,4,ch99data};
-
-/* char: 0x62 'b' */
-
-static const GLubyte ch98data[] = {
-0xe0,0x90,0x90,0x90,0xe0,0x80,0x80,
-};
-
-static const BitmapCharRec ch98 = {4,7,0,0,5,ch98data};
-
-/* char: 0x61 'a' */
-
-static const GLubyte ch97data[] = {
-0xe0,0xa0,0x60,0x20,0xc0,
-};
-
-static const BitmapCharRec ch97 = {3,5,0,0,4,ch97data};
-
-/* char: 0x60 '`' */
-
-static const GLubyte ch96data[] = {
-0xc0,0x80,
-};
-
-static const BitmapCharRec ch96 = {2,2,0,-5,3,ch96data};
-
-/* char: 0x5f '_' */
-
-static const GLubyte ch95data[] = {
-0xf8,
-};
-
-static const BitmapCharRec ch95 = {5,1,0,3,5,ch95data};
-
-/* char: 0x5e '^' */
-
-static const GLubyte ch94data[] = {
-0xa0,0xa0,0x40,
-};
-
-static const BitmapCharRec ch94 = {3,3,-1,-4,5,ch94data};
-
-/* char: 0x5d ']' */
-
-static const GLubyte ch93data[] = {
-0xc0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0xc0,
-};
-
-static const BitmapCharRec ch93 = {2,9,0,2,3,ch93data};
-
-/* char: 0x5c '\' */
-
-static const GLubyte ch92data[] = {
-0x20,0x20,0x40,0x40,0x40,0x80,0x80,
-};
-
-static const BitmapCharRec ch92 = {3,7,0,0,3,ch92data};
-
-/* char: 0x5b '[' */
-
-static const GLubyte ch91data[] = {
-0xc0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xc0,
-};
-
-static const BitmapCharRec ch91 = {2,9,0,2,3,ch91data};
-
-/* char: 0x5a 'Z' */
-
-static const GLubyte ch90data[] = {
-0xf8,0x88,0x40,0x20,0x10,0x88,0xf8,
-};
-
-static const BitmapCharRec ch90 = {5,7,0,0,6,ch90data};
-
-/* char: 0x59 'Y' */
-
-static const GLubyte ch89data[] = {
-0x38,0x10,0x10,0x28,0x28,0x44,0xee,
-};
-
-static const BitmapCharRec ch89 = {7,7,0,0,8,ch89data};
-
-/* char: 0x58 'X' */
-
-static const GLubyte ch88data[] = {
-0xee,0x44,0x28,0x10,0x28,0x44,0xee,
-};
-
-static const BitmapCharRec ch88 = {7,7,0,0,8,ch88data};
-
-/* char: 0x57 'W' */
-
-static const GLubyte ch87data[] = {
-0x22,0x0,0x22,0x0,0x55,0x0,0x55,0x0,0xc9,0x80,0x88,0x80,0xdd,0xc0,
-};
-
-static const BitmapCharRec ch87 = {10,7,0,0,10,ch87data};
-
-/* char: 0x56 'V' */
-
-static const GLubyte ch86data[] = {
-0x10,0x10,0x28,0x28,0x6c,0x44,0xee,
-};
-
-static const BitmapCharRec ch86 = {7,7,0,0,8,ch86data};
-
-/* char: 0x55 'U' */
-
-static const GLubyte ch85data[] = {
-0x38,0x6c,0x44,0x44,0x44,0x44,0xee,
-};
-
-static const BitmapCharRec ch85 = {7,7,0,0,8,ch85data};
-
-/* char: 0x54 'T' */
-
-static const GLubyte ch84data[] = {
-0x70,0x20,0x20,0x20,0x20,0xa8,0xf8,
-};
-
-static const BitmapCharRec ch84 = {5,7,0,0,6,ch84data};
-
-/* char: 0x53 'S' */
-
-static const GLubyte ch83data[] = {
-0xe0,0x90,0x10,0x60,0xc0,0x90,0x70,
-};
-
-static const BitmapCharRec ch83 = {4,7,0,0,5,ch83data};
-
-/* char: 0x52 'R' */
-
-static const GLubyte ch82data[] = {
-0xec,0x48,0x50,0x70,0x48,0x48,0xf0,
-};
-
-static const BitmapCharRec ch82 = {6,7,0,0,7,ch82data};
-
-/* char: 0x51 'Q' */
-
-static const GLubyte ch81data[] = {
-0xc,0x18,0x70,0xcc,0x84,0x84,0x84,0xcc,0x78,
-};
-
-static const BitmapCharRec ch81 = {6,9,0,2,7,ch81data};
-
-/* char: 0x50 'P' */
-
-static const GLubyte ch80data[] = {
-0xe0,0x40,0x40,0x70,0x48,0x48,0xf0,
-};
-
-static const BitmapCharRec ch80 = {5,7,0,0,6,ch80data};
-
-/* char: 0x4f 'O' */
-
-static const GLubyte ch79data[] = {
-0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,
-};
-
-static const BitmapCharRec ch79 = {6,7,0,0,7,ch79data};
-
-/* char: 0x4e 'N' */
-
-static const GLubyte ch78data[] = {
-0xe4,0x4c,0x4c,0x54,0x54,0x64,0xee,
-};
-
-static const BitmapCharRec ch78 = {7,7,0,0,8,ch78data};
-
-/* char: 0x4d 'M' */
-
-static const GLubyte ch77data[] = {
-0xeb,0x80,0x49,0x0,0x55,0x0,0x55,0x0,0x63,0x0,0x63,0x0,0xe3,0x80,
-};
-
-static const BitmapCharRec ch77 = {9,7,0,0,10,ch77data};
-
-/* char: 0x4c 'L' */
-
-static const GLubyte ch76data[] = {
-0xf8,0x48,0x40,0x40,0x40,0x40,0xe0,
-};
-
-static const BitmapCharRec ch76 = {5,7,0,0,6,ch76data};
-
-/* char: 0x4b 'K' */
-
-static const GLubyte ch75data[] = {
-0xec,0x48,0x50,0x60,0x50,0x48,0xec,
-};
-
-static const BitmapCharRec ch75 = {6,7,0,0,7,ch75data};
-
-/* char: 0x4a 'J' */
-
-static const GLubyte ch74data[] = {
-0xc0,0xa0,0x20,0x20,0x20,0x20,0x70,
-};
-
-static const BitmapCharRec ch74 = {4,7,0,0,4,ch74data};
-
-/* char: 0x49 'I' */
-
-static const GLubyte ch73data[] = {
-0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,
-};
-
-static const BitmapCharRec ch73 = {3,7,0,0,4,ch73data};
-
-/* char: 0x48 'H' */
-
-static const GLubyte ch72data[] = {
-0xee,0x44,0x44,0x7c,0x44,0x44,0xee,
-};
-
-static const BitmapCharRec ch72 = {7,7,0,0,8,ch72data};
-
-/* char: 0x47 'G' */
-
-static const GLubyte ch71data[] = {
-0x78,0xc4,0x84,0x9c,0x80,0xc4,0x7c,
-};
-
-static const BitmapCharRec ch71 = {6,7,0,0,7,ch71data};
-
-/* char: 0x46 'F' */
-
-static const GLubyte ch70data[] = {
-0xe0,0x40,0x40,0x70,0x40,0x48,0xf8,
-};
-
-static const BitmapCharRec ch70 = {5,7,0,0,6,ch70data};
-
-/* char: 0x45 'E' */
-
-static const GLubyte ch69data[] = {
-0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,
-};
-
-static const BitmapCharRec ch69 = {5,7,0,0,6,ch69data};
-
-/* char: 0x44 'D' */
-
-static const GLubyte ch68data[] = {
-0xf8,0x4c,0x44,0x44,0x44,0x4c,0xf8,
-};
-
-static const BitmapCharRec ch68 = {6,7,0,0,7,ch68data};
-
-/* char: 0x43 'C' */
-
-static const GLubyte ch67data[] = {
-0x78,0xc4,0x80,0x80,0x80,0xc4,0x7c,
-};
-
-static const BitmapCharRec ch67 = {6,7,0,0,7,ch67data};
-
-/* char: 0x42 'B' */
-
-static const GLubyte ch66data[] = {
-0xf0,0x48,0x48,0x70,0x48,0x48,0xf0,
-};
-
-static const BitmapCharRec ch66 = {5,7,0,0,6,ch66data};
-
-/* char: 0x41 'A' */
-
-static const GLubyte ch65data[] = {
-0xee,0x44,0x7c,0x28,0x28,0x38,0x10,
-};
-
-static const BitmapCharRec ch65 = {7,7,0,0,8,ch65data};
-
-/* char: 0x40 '@' */
-
-static const GLubyte ch64data[] = {
-0x3e,0x40,0x92,0xad,0xa5,0xa5,0x9d,0x42,0x3c,
-};
-
-static const BitmapCharRec ch64 = {8,9,0,2,9,ch64data};
-
-/* char: 0x3f '?' */
-
-static const GLubyte ch63data[] = {
-0x40,0x0,0x40,0x40,0x20,0xa0,0xe0,
-};
-
-static const BitmapCharRec ch63 = {3,7,0,0,4,ch63data};
-
-/* char: 0x3e '>' */
-
-static const GLubyte ch62data[] = {
-0x80,0x40,0x20,0x40,0x80,
-};
-
-static const BitmapCharRec ch62 = {3,5,0,0,5,ch62data};
-
-/* char: 0x3d '=' */
-
-static const GLubyte ch61data[] = {
-0xf8,0x0,0xf8,
-};
-
-static const BitmapCharRec ch61 = {5,3,0,-1,6,ch61data};
-
-/* char: 0x3c '<' */
-
-static const GLubyte ch60data[] = {
-0x20,0x40,0x80,0x40,0x20,
-};
-
-static const BitmapCharRec ch60 = {3,5,-1,0,5,ch60data};
-
-/* char: 0x3b ';' */
-
-static const GLubyte ch59data[] = {
-0x80,0x80,0x80,0x0,0x0,0x0,0x80,
-};
-
-static const BitmapCharRec ch59 = {1,7,-1,2,3,ch59data};
-
-/* char: 0x3a ':' */
-
-static const GLubyte ch58data[] = {
-0x80,0x0,0x0,0x0,0x80,
-};
-
-static const BitmapCharRec ch58 = {1,5,-1,0,3,ch58data};
-
-/* char: 0x39 '9' */
-
-static const GLubyte ch57data[] = {
-0xc0,0x20,0x70,0x90,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch57 = {4,7,0,0,5,ch57data};
-
-/* char: 0x38 '8' */
-
-static const GLubyte ch56data[] = {
-0x60,0x90,0x90,0x60,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch56 = {4,7,0,0,5,ch56data};
-
-/* char: 0x37 '7' */
-
-static const GLubyte ch55data[] = {
-0x40,0x40,0x40,0x20,0x20,0x90,0xf0,
-};
-
-static const BitmapCharRec ch55 = {4,7,0,0,5,ch55data};
-
-/* char: 0x36 '6' */
-
-static const GLubyte ch54data[] = {
-0x60,0x90,0x90,0x90,0xe0,0x40,0x30,
-};
-
-static const BitmapCharRec ch54 = {4,7,0,0,5,ch54data};
-
-/* char: 0x35 '5' */
-
-static const GLubyte ch53data[] = {
-0xe0,0x90,0x10,0x10,0xe0,0x40,0x70,
-};
-
-static const BitmapCharRec ch53 = {4,7,0,0,5,ch53data};
-
-/* char: 0x34 '4' */
-
-static const GLubyte ch52data[] = {
-0x10,0x10,0xf8,0x90,0x50,0x30,0x10,
-};
-
-static const BitmapCharRec ch52 = {5,7,0,0,5,ch52data};
-
-/* char: 0x33 '3' */
-
-static const GLubyte ch51data[] = {
-0xe0,0x10,0x10,0x60,0x10,0x90,0x60,
-};
-
-static const BitmapCharRec ch51 = {4,7,0,0,5,ch51data};
-
-/* char: 0x32 '2' */
-
-static const GLubyte ch50data[] = {
-0xf0,0x40,0x20,0x20,0x10,0x90,0x60,
-};
-
-static const BitmapCharRec ch50 = {4,7,0,0,5,ch50data};
-
-/* char: 0x31 '1' */
-
-static const GLubyte ch49data[] = {
-0xe0,0x40,0x40,0x40,0x40,0xc0,0x40,
-};
+/* X font: -adobe-times-medium-r-normal--10-100-75-75-p-54-iso8859-1 */
 
-static const BitmapCharRec ch49 = {3,7,-1,0,5,ch49data};
-
-/* char: 0x30 '0' */
-
-static const GLubyte ch48data[] = {
-0x60,0x90,0x90,0x90,0x90,0x90,0x60,
-};
-
-static const BitmapCharRec ch48 = {4,7,0,0,5,ch48data};
+#define glutBitmapTimesRoman10 XXX
+#include "glutbitmap.h"
+#undef glutBitmapTimesRoman10
 
+static const GLubyte bitmaps[] = {
+/* char: 0x21 '!' */
+0x80,0x0,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x22 '"' */
+0xa0,0xa0,
+/* char: 0x23 '#' */
+0x50,0x50,0xf8,0x50,0xf8,0x50,0x50,
+/* char: 0x24 '$' */
+0x20,0xe0,0x90,0x10,0x60,0x80,0x90,0x70,0x20,
+/* char: 0x25 '%' */
+0x44,0x2a,0x2a,0x56,0xa8,0xa4,0x7e,
+/* char: 0x26 '&' */
+0x76,0x8d,0x98,0x74,0x6e,0x50,0x30,
+/* char: 0x27 ''' */
+0x40,0xc0,
+/* char: 0x28 '(' */
+0x20,0x40,0x40,0x80,0x80,0x80,0x40,0x40,0x20,
+/* char: 0x29 ')' */
+0x80,0x40,0x40,0x20,0x20,0x20,0x40,0x40,0x80,
+/* char: 0x2a '*' */
+0xa0,0x40,0xa0,
+/* char: 0x2b '+' */
+0x20,0x20,0xf8,0x20,0x20,
+/* char: 0x2c ',' */
+0x80,0x80,0x80,
+/* char: 0x2d '-' */
+0xf0,
+/* char: 0x2e '.' */
+0x80,
 /* char: 0x2f '/' */
-
-static const GLubyte ch47data[] = {
 0x80,0x80,0x40,0x40,0x40,0x20,0x20,
-};
-
-static const BitmapCharRec ch47 = {3,7,0,0,3,ch47data};
-
-/* char: 0x2e '.' */
-
-static const GLubyte ch46data[] = {
+/* char: 0x30 '0' */
+0x60,0x90,0x90,0x90,0x90,0x90,0x60,
+/* char: 0x31 '1' */
+0xe0,0x40,0x40,0x40,0x40,0xc0,0x40,
+/* char: 0x32 '2' */
+0xf0,0x40,0x20,0x20,0x10,0x90,0x60,
+/* char: 0x33 '3' */
+0xe0,0x10,0x10,0x60,0x10,0x90,0x60,
+/* char: 0x34 '4' */
+0x10,0x10,0xf8,0x90,0x50,0x30,0x10,
+/* char: 0x35 '5' */
+0xe0,0x90,0x10,0x10,0xe0,0x40,0x70,
+/* char: 0x36 '6' */
+0x60,0x90,0x90,0x90,0xe0,0x40,0x30,
+/* char: 0x37 '7' */
+0x40,0x40,0x40,0x20,0x20,0x90,0xf0,
+/* char: 0x38 '8' */
+0x60,0x90,0x90,0x60,0x90,0x90,0x60,
+/* char: 0x39 '9' */
+0xc0,0x20,0x70,0x90,0x90,0x90,0x60,
+/* char: 0x3a ':' */
+0x80,0x0,0x0,0x0,0x80,
+/* char: 0x3b ';' */
+0x80,0x80,0x80,0x0,0x0,0x0,0x80,
+/* char: 0x3c '<' */
+0x20,0x40,0x80,0x40,0x20,
+/* char: 0x3d '=' */
+0xf8,0x0,0xf8,
+/* char: 0x3e '>' */
+0x80,0x40,0x20,0x40,0x80,
+/* char: 0x3f '?' */
+0x40,0x0,0x40,0x40,0x20,0xa0,0xe0,
+/* char: 0x40 '@' */
+0x3e,0x40,0x92,0xad,0xa5,0xa5,0x9d,0x42,0x3c,
+/* char: 0x41 'A' */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,
+/* char: 0x42 'B' */
+0xf0,0x48,0x48,0x70,0x48,0x48,0xf0,
+/* char: 0x43 'C' */
+0x78,0xc4,0x80,0x80,0x80,0xc4,0x7c,
+/* char: 0x44 'D' */
+0xf8,0x4c,0x44,0x44,0x44,0x4c,0xf8,
+/* char: 0x45 'E' */
+0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,
+/* char: 0x46 'F' */
+0xe0,0x40,0x40,0x70,0x40,0x48,0xf8,
+/* char: 0x47 'G' */
+0x78,0xc4,0x84,0x9c,0x80,0xc4,0x7c,
+/* char: 0x48 'H' */
+0xee,0x44,0x44,0x7c,0x44,0x44,0xee,
+/* char: 0x49 'I' */
+0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,
+/* char: 0x4a 'J' */
+0xc0,0xa0,0x20,0x20,0x20,0x20,0x70,
+/* char: 0x4b 'K' */
+0xec,0x48,0x50,0x60,0x50,0x48,0xec,
+/* char: 0x4c 'L' */
+0xf8,0x48,0x40,0x40,0x40,0x40,0xe0,
+/* char: 0x4d 'M' */
+0xeb,0x80,0x49,0x0,0x55,0x0,0x55,0x0,0x63,0x0,0x63,0x0,0xe3,0x80,
+/* char: 0x4e 'N' */
+0xe4,0x4c,0x4c,0x54,0x54,0x64,0xee,
+/* char: 0x4f 'O' */
+0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,
+/* char: 0x50 'P' */
+0xe0,0x40,0x40,0x70,0x48,0x48,0xf0,
+/* char: 0x51 'Q' */
+0xc,0x18,0x70,0xcc,0x84,0x84,0x84,0xcc,0x78,
+/* char: 0x52 'R' */
+0xec,0x48,0x50,0x70,0x48,0x48,0xf0,
+/* char: 0x53 'S' */
+0xe0,0x90,0x10,0x60,0xc0,0x90,0x70,
+/* char: 0x54 'T' */
+0x70,0x20,0x20,0x20,0x20,0xa8,0xf8,
+/* char: 0x55 'U' */
+0x38,0x6c,0x44,0x44,0x44,0x44,0xee,
+/* char: 0x56 'V' */
+0x10,0x10,0x28,0x28,0x6c,0x44,0xee,
+/* char: 0x57 'W' */
+0x22,0x0,0x22,0x0,0x55,0x0,0x55,0x0,0xc9,0x80,0x88,0x80,0xdd,0xc0,
+/* char: 0x58 'X' */
+0xee,0x44,0x28,0x10,0x28,0x44,0xee,
+/* char: 0x59 'Y' */
+0x38,0x10,0x10,0x28,0x28,0x44,0xee,
+/* char: 0x5a 'Z' */
+0xf8,0x88,0x40,0x20,0x10,0x88,0xf8,
+/* char: 0x5b '[' */
+0xc0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xc0,
+/* char: 0x5c '\' */
+0x20,0x20,0x40,0x40,0x40,0x80,0x80,
+/* char: 0x5d ']' */
+0xc0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0xc0,
+/* char: 0x5e '^' */
+0xa0,0xa0,0x40,
+/* char: 0x5f '_' */
+0xf8,
+/* char: 0x60 '`' */
+0xc0,0x80,
+/* char: 0x61 'a' */
+0xe0,0xa0,0x60,0x20,0xc0,
+/* char: 0x62 'b' */
+0xe0,0x90,0x90,0x90,0xe0,0x80,0x80,
+/* char: 0x63 'c' */
+0x60,0x80,0x80,0x80,0x60,
+/* char: 0x64 'd' */
+0x68,0x90,0x90,0x90,0x70,0x10,0x30,
+/* char: 0x65 'e' */
+0x60,0x80,0xc0,0xa0,0x60,
+/* char: 0x66 'f' */
+0xe0,0x40,0x40,0x40,0xe0,0x40,0x30,
+/* char: 0x67 'g' */
+0xe0,0x90,0x60,0x40,0xa0,0xa0,0x70,
+/* char: 0x68 'h' */
+0xd8,0x90,0x90,0x90,0xe0,0x80,0x80,
+/* char: 0x69 'i' */
+0x40,0x40,0x40,0x40,0xc0,0x0,0x40,
+/* char: 0x6a 'j' */
+0x80,0x40,0x40,0x40,0x40,0x40,0xc0,0x0,0x40,
+/* char: 0x6b 'k' */
+0x98,0x90,0xe0,0xa0,0x90,0x80,0x80,
+/* char: 0x6c 'l' */
+0xe0,0x40,0x40,0x40,0x40,0x40,0xc0,
+/* char: 0x6d 'm' */
+0xdb,0x92,0x92,0x92,0xec,
+/* char: 0x6e 'n' */
+0xd8,0x90,0x90,0x90,0xe0,
+/* char: 0x6f 'o' */
+0x60,0x90,0x90,0x90,0x60,
+/* char: 0x70 'p' */
+0xc0,0x80,0xe0,0x90,0x90,0x90,0xe0,
+/* char: 0x71 'q' */
+0x38,0x10,0x70,0x90,0x90,0x90,0x70,
+/* char: 0x72 'r' */
+0xe0,0x40,0x40,0x60,0xa0,
+/* char: 0x73 's' */
+0xe0,0x20,0x60,0x80,0xe0,
+/* char: 0x74 't' */
+0x30,0x40,0x40,0x40,0xe0,0x40,
+/* char: 0x75 'u' */
+0x68,0x90,0x90,0x90,0x90,
+/* char: 0x76 'v' */
+0x20,0x60,0x50,0x90,0xd8,
+/* char: 0x77 'w' */
+0x28,0x6c,0x54,0x92,0xdb,
+/* char: 0x78 'x' */
+0xd8,0x50,0x20,0x50,0xd8,
+/* char: 0x79 'y' */
+0x40,0x40,0x20,0x30,0x50,0x48,0xdc,
+/* char: 0x7a 'z' */
+0xf0,0x90,0x40,0x20,0xf0,
+/* char: 0x7b '{' */
+0x20,0x40,0x40,0x40,0x80,0x40,0x40,0x40,0x20,
+/* char: 0x7c '|' */
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+/* char: 0x7d '}' */
+0x80,0x40,0x40,0x40,0x20,0x40,0x40,0x40,0x80,
+/* char: 0x7e '~' */
+0x98,0x64,
+/* char: 0xa1 */
+0x80,0x80,0x80,0x80,0x80,0x0,0x80,
+/* char: 0xa2 */
+0x80,0xe0,0x90,0x80,0x90,0x70,0x10,
+/* char: 0xa3 */
+0xf0,0xc8,0x40,0xe0,0x40,0x50,0x30,
+/* char: 0xa4 */
+0x88,0x70,0x50,0x50,0x70,0x88,
+/* char: 0xa5 */
+0x70,0x20,0xf8,0x20,0xd8,0x50,0x88,
+/* char: 0xa6 */
+0x80,0x80,0x80,0x0,0x80,0x80,0x80,
+/* char: 0xa7 */
+0xe0,0x90,0x20,0x50,0x90,0xa0,0x40,0x90,0x70,
+/* char: 0xa8 */
+0xa0,
+/* char: 0xa9 */
+0x38,0x44,0x9a,0xa2,0x9a,0x44,0x38,
+/* char: 0xaa */
+0xe0,0x0,0xa0,0x20,0xc0,
+/* char: 0xab */
+0x50,0xa0,0xa0,0x50,
+/* char: 0xac */
+0x8,0x8,0xf8,
+/* char: 0xad */
+0xe0,
+/* char: 0xae */
+0x38,0x44,0xaa,0xb2,0xba,0x44,0x38,
+/* char: 0xaf */
+0xe0,
+/* char: 0xb0 */
+0x60,0x90,0x90,0x60,
+/* char: 0xb1 */
+0xf8,0x0,0x20,0x20,0xf8,0x20,0x20,
+/* char: 0xb2 */
+0xe0,0x40,0xa0,0x60,
+/* char: 0xb3 */
+0xc0,0x20,0x40,0xe0,
+/* char: 0xb4 */
+0x80,0x40,
+/* char: 0xb5 */
+0x80,0x80,0xe8,0x90,0x90,0x90,0x90,
+/* char: 0xb6 */
+0x28,0x28,0x28,0x28,0x68,0xe8,0xe8,0xe8,0x7c,
+/* char: 0xb7 */
 0x80,
+/* char: 0xb8 */
+0xc0,0x20,0x40,
+/* char: 0xb9 */
+0xe0,0x40,0xc0,0x40,
+/* char: 0xba */
+0xe0,0x0,0x40,0xa0,0x40,
+/* char: 0xbb */
+0xa0,0x50,0x50,0xa0,
+/* char: 0xbc */
+0x44,0x3e,0x2c,0xf4,0x48,0xc8,0x44,
+/* char: 0xbd */
+0x4e,0x24,0x2a,0xf6,0x48,0xc8,0x44,
+/* char: 0xbe */
+0x44,0x3e,0x2c,0xd4,0x28,0x48,0xe4,
+/* char: 0xbf */
+0xe0,0xa0,0x80,0x40,0x40,0x0,0x40,
+/* char: 0xc0 */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x10,0x20,
+/* char: 0xc1 */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x10,0x8,
+/* char: 0xc2 */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x28,0x10,
+/* char: 0xc3 */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x28,0x14,
+/* char: 0xc4 */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x0,0x28,
+/* char: 0xc5 */
+0xee,0x44,0x7c,0x28,0x28,0x38,0x10,0x10,0x28,0x10,
+/* char: 0xc6 */
+0xef,0x49,0x78,0x2e,0x28,0x39,0x1f,
+/* char: 0xc7 */
+0x60,0x10,0x20,0x78,0xc4,0x80,0x80,0x80,0xc4,0x7c,
+/* char: 0xc8 */
+0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x20,0x40,
+/* char: 0xc9 */
+0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x20,0x10,
+/* char: 0xca */
+0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x50,0x20,
+/* char: 0xcb */
+0xf8,0x48,0x40,0x70,0x40,0x48,0xf8,0x0,0x50,
+/* char: 0xcc */
+0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0x40,0x80,
+/* char: 0xcd */
+0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0x40,0x20,
+/* char: 0xce */
+0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0xa0,0x40,
+/* char: 0xcf */
+0xe0,0x40,0x40,0x40,0x40,0x40,0xe0,0x0,0xa0,
+/* char: 0xd0 */
+0xf8,0x4c,0x44,0xe4,0x44,0x4c,0xf8,
+/* char: 0xd1 */
+0xe4,0x4c,0x4c,0x54,0x54,0x64,0xee,0x0,0x50,0x28,
+/* char: 0xd2 */
+0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x20,0x40,
+/* char: 0xd3 */
+0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x10,0x8,
+/* char: 0xd4 */
+0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x50,0x20,
+/* char: 0xd5 */
+0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x50,0x28,
+/* char: 0xd6 */
+0x78,0xcc,0x84,0x84,0x84,0xcc,0x78,0x0,0x50,
+/* char: 0xd7 */
+0x88,0x50,0x20,0x50,0x88,
+/* char: 0xd8 */
+0x80,0x7c,0x66,0x52,0x52,0x4a,0x66,0x3e,0x1,
+/* char: 0xd9 */
+0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x10,0x20,
+/* char: 0xda */
+0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x10,0x8,
+/* char: 0xdb */
+0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x28,0x10,
+/* char: 0xdc */
+0x38,0x6c,0x44,0x44,0x44,0x44,0xee,0x0,0x28,
+/* char: 0xdd */
+0x38,0x10,0x10,0x28,0x28,0x44,0xee,0x0,0x10,0x8,
+/* char: 0xde */
+0xe0,0x40,0x70,0x48,0x70,0x40,0xe0,
+/* char: 0xdf */
+0xe0,0x50,0x50,0x60,0x50,0x50,0x20,
+/* char: 0xe0 */
+0xe0,0xa0,0x60,0x20,0xc0,0x0,0x40,0x80,
+/* char: 0xe1 */
+0xe0,0xa0,0x60,0x20,0xc0,0x0,0x40,0x20,
+/* char: 0xe2 */
+0xe0,0xa0,0x60,0x20,0xc0,0x0,0xa0,0x40,
+/* char: 0xe3 */
+0xe0,0xa0,0x60,0x20,0xc0,0x0,0xa0,0x50,
+/* char: 0xe4 */
+0xe0,0xa0,0x60,0x20,0xc0,0x0,0xa0,
+/* char: 0xe5 */
+0xe0,0xa0,0x60,0x20,0xc0,0x40,0xa0,0x40,
+/* char: 0xe6 */
+0xd8,0xa0,0x70,0x28,0xd8,
+/* char: 0xe7 */
+0xc0,0x20,0x40,0x60,0x80,0x80,0x80,0x60,
+/* char: 0xe8 */
+0x60,0x80,0xc0,0xa0,0x60,0x0,0x40,0x80,
+/* char: 0xe9 */
+0x60,0x80,0xc0,0xa0,0x60,0x0,0x40,0x20,
+/* char: 0xea */
+0x60,0x80,0xc0,0xa0,0x60,0x0,0xa0,0x40,
+/* char: 0xeb */
+0x60,0x80,0xc0,0xa0,0x60,0x0,0xa0,
+/* char: 0xec */
+0xe0,0x40,0x40,0x40,0xc0,0x0,0x40,0x80,
+/* char: 0xed */
+0xe0,0x40,0x40,0x40,0xc0,0x0,0x40,0x20,
+/* char: 0xee */
+0xe0,0x40,0x40,0x40,0xc0,0x0,0xa0,0x40,
+/* char: 0xef */
+0xe0,0x40,0x40,0x40,0xc0,0x0,0xa0,
+/* char: 0xf0 */
+0x60,0x90,0x90,0x90,0x70,0xa0,0x70,0x40,
+/* char: 0xf1 */
+0xd8,0x90,0x90,0x90,0xe0,0x0,0xa0,0x50,
+/* char: 0xf2 */
+0x60,0x90,0x90,0x90,0x60,0x0,0x20,0x40,
+/* char: 0xf3 */
+0x60,0x90,0x90,0x90,0x60,0x0,0x40,0x20,
+/* char: 0xf4 */
+0x60,0x90,0x90,0x90,0x60,0x0,0xa0,0x40,
+/* char: 0xf5 */
+0x60,0x90,0x90,0x90,0x60,0x0,0xa0,0x50,
+/* char: 0xf6 */
+0x60,0x90,0x90,0x90,0x60,0x0,0xa0,
+/* char: 0xf7 */
+0x20,0x0,0xf8,0x0,0x20,
+/* char: 0xf8 */
+0x80,0x70,0x48,0x48,0x48,0x38,0x4,
+/* char: 0xf9 */
+0x68,0x90,0x90,0x90,0x90,0x0,0x20,0x40,
+/* char: 0xfa */
+0x68,0x90,0x90,0x90,0x90,0x0,0x40,0x20,
+/* char: 0xfb */
+0x68,0x90,0x90,0x90,0x90,0x0,0x50,0x20,
+/* char: 0xfc */
+0x68,0x90,0x90,0x90,0x90,0x0,0x50,
+/* char: 0xfd */
+0x80,0xc0,0x40,0x60,0xa0,0x90,0xb8,0x0,0x20,0x10,
+/* char: 0xfe */
+0xc0,0x80,0xe0,0x90,0x90,0x90,0xe0,0x80,0x80,
+/* char: 0xff */
+0x80,0xc0,0x40,0x60,0xa0,0x90,0xb8,0x0,0xa0,
 };
 
-static const BitmapCharRec ch46 = {1,1,-1,0,3,ch46data};
-
-/* char: 0x2d '-' */
-
-static const GLubyte ch45data[] = {
-0xf0,
-};
-
-static const BitmapCharRec ch45 = {4,1,-1,-2,7,ch45data};
-
-/* char: 0x2c ',' */
-
-static const GLubyte ch44data[] = {
-0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch44 = {1,3,-1,2,3,ch44data};
-
-/* char: 0x2b '+' */
-
-static const GLubyte ch43data[] = {
-0x20,0x20,0xf8,0x20,0x20,
-};
-
-static const BitmapCharRec ch43 = {5,5,0,0,6,ch43data};
-
-/* char: 0x2a '*' */
-
-static const GLubyte ch42data[] = {
-0xa0,0x40,0xa0,
-};
-
-static const BitmapCharRec ch42 = {3,3,0,-4,5,ch42data};
-
-/* char: 0x29 ')' */
-
-static const GLubyte ch41data[] = {
-0x80,0x40,0x40,0x20,0x20,0x20,0x40,0x40,0x80,
-};
-
-static const BitmapCharRec ch41 = {3,9,0,2,4,ch41data};
-
-/* char: 0x28 '(' */
-
-static const GLubyte ch40data[] = {
-0x20,0x40,0x40,0x80,0x80,0x80,0x40,0x40,0x20,
-};
-
-static const BitmapCharRec ch40 = {3,9,0,2,4,ch40data};
-
-/* char: 0x27 ''' */
-
-static const GLubyte ch39data[] = {
-0x40,0xc0,
-};
-
-static const BitmapCharRec ch39 = {2,2,0,-5,3,ch39data};
-
-/* char: 0x26 '&' */
-
-static const GLubyte ch38data[] = {
-0x76,0x8d,0x98,0x74,0x6e,0x50,0x30,
-};
-
-static const BitmapCharRec ch38 = {8,7,0,0,8,ch38data};
-
-/* char: 0x25 '%' */
-
-static const GLubyte ch37data[] = {
-0x44,0x2a,0x2a,0x56,0xa8,0xa4,0x7e,
-};
-
-static const BitmapCharRec ch37 = {7,7,0,0,8,ch37data};
-
-/* char: 0x24 '$' */
-
-static const GLubyte ch36data[] = {
-0x20,0xe0,0x90,0x10,0x60,0x80,0x90,0x70,0x20,
-};
-
-static const BitmapCharRec ch36 = {4,9,0,1,5,ch36data};
-
-/* char: 0x23 '#' */
-
-static const GLubyte ch35data[] = {
-0x50,0x50,0xf8,0x50,0xf8,0x50,0x50,
-};
-
-static const BitmapCharRec ch35 = {5,7,0,0,5,ch35data};
-
-/* char: 0x22 '"' */
-
-static const GLubyte ch34data[] = {
-0xa0,0xa0,
-};
-
-static const BitmapCharRec ch34 = {3,2,0,-5,4,ch34data};
-
-/* char: 0x21 '!' */
-
-static const GLubyte ch33data[] = {
-0x80,0x0,0x80,0x80,0x80,0x80,0x80,
-};
-
-static const BitmapCharRec ch33 = {1,7,-1,0,3,ch33data};
-
-/* char: 0x20 ' ' */
-
-#ifdef _WIN32
-/* XXX Work around Microsoft OpenGL 1.1 bug where glBitmap with
-   a height or width of zero does not advance the raster position
-   as specified by OpenGL. (Cosmo OpenGL does not have this bug.) */
-static const GLubyte ch32data[] = { 0x0 };
-static const BitmapCharRec ch32 = {1,1,0,0,2,ch32data};
-#else
-static const BitmapCharRec ch32 = {0,0,0,0,2,0};
-#endif
-
-static const BitmapCharRec * const chars[] = {
-&ch32,
-&ch33,
-&ch34,
-&ch35,
-&ch36,
-&ch37,
-&ch38,
-&ch39,
-&ch40,
-&ch41,
-&ch42,
-&ch43,
-&ch44,
-&ch45,
-&ch46,
-&ch47,
-&ch48,
-&ch49,
-&ch50,
-&ch51,
-&ch52,
-&ch53,
-&ch54,
-&ch55,
-&ch56,
-&ch57,
-&ch58,
-&ch59,
-&ch60,
-&ch61,
-&ch62,
-&ch63,
-&ch64,
-&ch65,
-&ch66,
-&ch67,
-&ch68,
-&ch69,
-&ch70,
-&ch71,
-&ch72,
-&ch73,
-&ch74,
-&ch75,
-&ch76,
-&ch77,
-&ch78,
-&ch79,
-&ch80,
-&ch81,
-&ch82,
-&ch83,
-&ch84,
-&ch85,
-&ch86,
-&ch87,
-&ch88,
-&ch89,
-&ch90,
-&ch91,
-&ch92,
-&ch93,
-&ch94,
-&ch95,
-&ch96,
-&ch97,
-&ch98,
-&ch99,
-&ch100,
-&ch101,
-&ch102,
-&ch103,
-&ch104,
-&ch105,
-&ch106,
-&ch107,
-&ch108,
-&ch109,
-&ch110,
-&ch111,
-&ch112,
-&ch113,
-&ch114,
-&ch115,
-&ch116,
-&ch117,
-&ch118,
-&ch119,
-&ch120,
-&ch121,
-&ch122,
-&ch123,
-&ch124,
-&ch125,
-&ch126,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-0,
-&ch160,
-&ch161,
-&ch162,
-&ch163,
-&ch164,
-&ch165,
-&ch166,
-&ch167,
-&ch168,
-&ch169,
-&ch170,
-&ch171,
-&ch172,
-&ch173,
-&ch174,
-&ch175,
-&ch176,
-&ch177,
-&ch178,
-&ch179,
-&ch180,
-&ch181,
-&ch182,
-&ch183,
-&ch184,
-&ch185,
-&ch186,
-&ch187,
-&ch188,
-&ch189,
-&ch190,
-&ch191,
-&ch192,
-&ch193,
-&ch194,
-&ch195,
-&ch196,
-&ch197,
-&ch198,
-&ch199,
-&ch200,
-&ch201,
-&ch202,
-&ch203,
-&ch204,
-&ch205,
-&ch206,
-&ch207,
-&ch208,
-&ch209,
-&ch210,
-&ch211,
-&ch212,
-&ch213,
-&ch214,
-&ch215,
-&ch216,
-&ch217,
-&ch218,
-&ch219,
-&ch220,
-&ch221,
-&ch222,
-&ch223,
-&ch224,
-&ch225,
-&ch226,
-&ch227,
-&ch228,
-&ch229,
-&ch230,
-&ch231,
-&ch232,
-&ch233,
-&ch234,
-&ch235,
-&ch236,
-&ch237,
-&ch238,
-&ch239,
-&ch240,
-&ch241,
-&ch242,
-&ch243,
-&ch244,
-&ch245,
-&ch246,
-&ch247,
-&ch248,
-&ch249,
-&ch250,
-&ch251,
-&ch252,
-&ch253,
-&ch254,
-&ch255,
+static const BitmapCharRec chars[] = {
+{0,0,0,0,2,0},
+{1,7,-1,0,3,0},
+{3,2,0,-5,4,7},
+{5,7,0,0,5,9},
+{4,9,0,1,5,16},
+{7,7,0,0,8,25},
+{8,7,0,0,8,32},
+{2,2,0,-5,3,39},
+{3,9,0,2,4,41},
+{3,9,0,2,4,50},
+{3,3,0,-4,5,59},
+{5,5,0,0,6,62},
+{1,3,-1,2,3,67},
+{4,1,-1,-2,7,70},
+{1,1,-1,0,3,71},
+{3,7,0,0,3,72},
+{4,7,0,0,5,79},
+{3,7,-1,0,5,86},
+{4,7,0,0,5,93},
+{4,7,0,0,5,100},
+{5,7,0,0,5,107},
+{4,7,0,0,5,114},
+{4,7,0,0,5,121},
+{4,7,0,0,5,128},
+{4,7,0,0,5,135},
+{4,7,0,0,5,142},
+{1,5,-1,0,3,149},
+{1,7,-1,2,3,154},
+{3,5,-1,0,5,161},
+{5,3,0,-1,6,166},
+{3,5,0,0,5,169},
+{3,7,0,0,4,174},
+{8,9,0,2,9,181},
+{7,7,0,0,8,190},
+{5,7,0,0,6,197},
+{6,7,0,0,7,204},
+{6,7,0,0,7,211},
+{5,7,0,0,6,218},
+{5,7,0,0,6,225},
+{6,7,0,0,7,232},
+{7,7,0,0,8,239},
+{3,7,0,0,4,246},
+{4,7,0,0,4,253},
+{6,7,0,0,7,260},
+{5,7,0,0,6,267},
+{9,7,0,0,10,274},
+{7,7,0,0,8,288},
+{6,7,0,0,7,295},
+{5,7,0,0,6,302},
+{6,9,0,2,7,309},
+{6,7,0,0,7,318},
+{4,7,0,0,5,325},
+{5,7,0,0,6,332},
+{7,7,0,0,8,339},
+{7,7,0,0,8,346},
+{10,7,0,0,10,353},
+{7,7,0,0,8,367},
+{7,7,0,0,8,374},
+{5,7,0,0,6,381},
+{2,9,0,2,3,388},
+{3,7,0,0,3,397},
+{2,9,0,2,3,404},
+{3,3,-1,-4,5,413},
+{5,1,0,3,5,416},
+{2,2,0,-5,3,417},
+{3,5,0,0,4,419},
+{4,7,0,0,5,424},
+{3,5,0,0,4,431},
+{5,7,0,0,5,436},
+{3,5,0,0,4,443},
+{4,7,0,0,4,448},
+{4,7,0,2,5,455},
+{5,7,0,0,5,462},
+{2,7,0,0,3,469},
+{2,9,0,2,3,476},
+{5,7,0,0,5,485},
+{3,7,0,0,4,492},
+{8,5,0,0,8,499},
+{5,5,0,0,5,504},
+{4,5,0,0,5,509},
+{4,7,0,2,5,514},
+{5,7,0,2,5,521},
+{3,5,0,0,4,528},
+{3,5,0,0,4,533},
+{4,6,0,0,4,538},
+{5,5,0,0,5,544},
+{5,5,0,0,5,549},
+{8,5,0,0,8,554},
+{5,5,0,0,6,559},
+{6,7,1,2,5,564},
+{4,5,0,0,5,571},
+{3,9,0,2,4,576},
+{1,9,0,2,2,585},
+{3,9,0,2,4,594},
+{6,2,0,-2,7,603},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,0,0},
+{0,0,0,0,2,0},
+{1,7,-1,2,3,605},
+{4,7,0,1,5,612},
+{5,7,0,0,5,619},
+{5,6,0,-1,5,626},
+{5,7,0,0,5,632},
+{1,7,0,0,2,639},
+{4,9,0,1,5,646},
+{3,1,-1,-6,5,655},
+{7,7,-1,0,9,656},
+{3,5,0,-2,4,663},
+{4,4,0,-1,5,668},
+{5,3,-1,-1,7,672},
+{3,1,0,-2,4,675},
+{7,7,-1,0,9,676},
+{3,1,0,-6,4,683},
+{4,4,0,-3,4,684},
+{5,7,0,0,6,688},
+{3,4,0,-3,3,695},
+{3,4,0,-3,3,699},
+{2,2,0,-5,3,703},
+{5,7,0,2,5,705},
+{6,9,0,2,6,712},
+{1,1,0,-2,2,721},
+{3,3,0,3,4,722},
+{3,4,0,-3,3,725},
+{3,5,0,-2,4,729},
+{4,4,0,-1,5,734},
+{7,7,0,0,8,738},
+{7,7,0,0,8,745},
+{7,7,0,0,8,752},
+{3,7,0,2,4,759},
+{7,10,0,0,8,766},
+{7,10,0,0,8,776},
+{7,10,0,0,8,786},
+{7,10,0,0,8,796},
+{7,9,0,0,8,806},
+{7,10,0,0,8,815},
+{8,7,0,0,9,825},
+{6,10,0,3,7,832},
+{5,10,0,0,6,842},
+{5,10,0,0,6,852},
+{5,10,0,0,6,862},
+{5,9,0,0,6,872},
+{3,10,0,0,4,881},
+{3,10,0,0,4,891},
+{3,10,0,0,4,901},
+{3,9,0,0,4,911},
+{6,7,0,0,7,920},
+{7,10,0,0,8,927},
+{6,10,0,0,7,937},
+{6,10,0,0,7,947},
+{6,10,0,0,7,957},
+{6,10,0,0,7,967},
+{6,9,0,0,7,977},
+{5,5,0,0,6,986},
+{8,9,0,1,8,991},
+{7,10,0,0,8,1000},
+{7,10,0,0,8,1010},
+{7,10,0,0,8,1020},
+{7,9,0,0,8,1030},
+{7,10,0,0,8,1039},
+{5,7,0,0,6,1049},
+{4,7,0,0,5,1056},
+{3,8,0,0,4,1063},
+{3,8,0,0,4,1071},
+{3,8,0,0,4,1079},
+{4,8,0,0,4,1087},
+{3,7,0,0,4,1095},
+{3,8,0,0,4,1102},
+{5,5,0,0,6,1110},
+{3,8,0,3,4,1115},
+{3,8,0,0,4,1123},
+{3,8,0,0,4,1131},
+{3,8,0,0,4,1139},
+{3,7,0,0,4,1147},
+{3,8,0,0,4,1154},
+{3,8,0,0,4,1162},
+{3,8,0,0,4,1170},
+{3,7,0,0,4,1178},
+{4,8,0,0,5,1185},
+{5,8,0,0,5,1193},
+{4,8,0,0,5,1201},
+{4,8,0,0,5,1209},
+{4,8,0,0,5,1217},
+{4,8,0,0,5,1225},
+{4,7,0,0,5,1233},
+{5,5,0,0,6,1240},
+{6,7,1,1,5,1245},
+{5,8,0,0,5,1252},
+{5,8,0,0,5,1260},
+{5,8,0,0,5,1268},
+{5,7,0,0,5,1276},
+{5,10,0,2,5,1283},
+{4,9,0,2,5,1293},
+{5,9,0,2,5,1302},
 };
 
 const BitmapFontRec glutBitmapTimesRoman10 = {
 224,
 32,
-chars
+chars,
+bitmaps
 };
-
@@ -15,6 +15,12 @@
 void GLUTAPIENTRY
 glutWarpPointer(int x, int y)
 {
+#if !defined(_WIN32)
+  if (__glutNullWindowSystem) {
+    __glutNullWarpPointer(__glutCurrentWindow, x, y);
+    return;
+  }
+#endif
   XWarpPointer(__glutDisplay, None, __glutCurrentWindow->win,
     0, 0, 0, 0, x, y);
   XFlush(__glutDisplay);
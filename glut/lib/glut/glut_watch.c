@@ -0,0 +1,564 @@
+
+/* Copyright (c) Mark J. Kilgard, 2026. */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* What the GLUT main loop blocks on.  Besides the X connection and
+   the next timer deadline, an application can have the loop watch
+   its own file descriptors (glutWatchFd) and can wake the loop from
+   another thread or a signal handler (glutWakeup), so work that
+   arrives from outside X needs no idle callback polling for it.
+
+   Other threads can also hand the main loop work to run
+   (glutRunOnMainLoop) or windows to redisplay
+   (glutPostWindowRedisplayFromThread).  Each pushes a node onto a
+   lock-free stack and wakes the loop; the main loop takes the whole
+   stack with a compare and swap and runs it oldest first.
+
+   On Linux the loop waits in epoll_wait, with the X connection,
+   the wakeup eventfd, and the watched descriptors all registered
+   once.  Timer deadlines go to a timerfd in the same set rather
+   than to epoll_wait's millisecond timeout, so a timer fires
+   within the kernel's wakeup latency of its deadline instead of
+   up to a millisecond late.  Other Unix systems rebuild select
+   masks for each wait and time out to the microsecond.
+   Win32 has no descriptors to watch, but glutWakeup works there by
+   posting a message to the thread that called glutInit. */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+
+#ifndef _WIN32
+# include <sys/types.h>
+# include <sys/time.h>
+# include <unistd.h>
+# include <fcntl.h>
+# ifdef __linux__
+#  define GLUT_USE_EPOLL
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <sys/timerfd.h>
+# elif defined(SVR4) || defined(CRAY) || defined(AIXV3) || defined(AIXV4)
+#  include <sys/select.h>
+# endif
+#endif
+
+#include "glutint.h"
+
+typedef struct _GLUTdeferred GLUTdeferred;
+struct _GLUTdeferred {
+  GLUTdeferred *next;
+  GLUTdeferredCB func;  /* NULL to redisplay window */
+  void *data;
+  int window;
+};
+
+#if defined(_WIN32)
+# define swapFlag(p, v) InterlockedExchange((LONG volatile *) (p), (v))
+# define comparePointer(p, old, v) \
+  (InterlockedCompareExchangePointer((PVOID volatile *) (p), (v), (old)) == (old))
+#elif defined(__GNUC__)
+# define swapFlag(p, v) __sync_lock_test_and_set((p), (v))
+# define comparePointer(p, old, v) __sync_bool_compare_and_swap((p), (old), (v))
+#else
+/* Not atomic; at worst a wakeup writes the descriptor twice.  But
+   without an atomic compare and swap, only the main thread may
+   post deferred work. */
+static int
+swapFlag(volatile int *p, int v)
+{
+  int old = *p;
+
+  *p = v;
+  return old;
+}
+
+static int
+comparePointer(GLUTdeferred * volatile *p, GLUTdeferred * old,
+  GLUTdeferred * v)
+{
+  *p = v;
+  return 1;
+}
+#endif
+
+typedef struct _GLUTwatch {
+  GLUTwatchCB func;
+  int events;           /* GLUT_WATCH_READ and/or GLUT_WATCH_WRITE; 0 if unused */
+} GLUTwatch;
+
+/* GLUT inter-file variables */
+int __glutWatchCount = 0;
+volatile int __glutWakeupPending = 0;
+
+static GLUTwakeupCB wakeupFunc = NULL;
+static volatile int wakeupRequested = 0;  /* glutWakeup since the callback */
+static GLUTdeferred *volatile deferredStack = NULL;  /* newest first */
+#ifdef _WIN32
+static DWORD wakeupThread;
+#else
+static GLUTwatch *watchTable = NULL;   /* indexed by descriptor */
+static int watchTableSize = 0;
+static int wakeupFD[2] = { -1, -1 };   /* read and write ends */
+# ifdef GLUT_USE_EPOLL
+static int epollFD = -1;
+static int epollConnectionFD = -1;     /* X connection as registered */
+static int timerFD = -1;
+static GLUTnanoseconds timerArmed = GLUT_WAIT_FOREVER;
+# endif
+
+# ifdef GLUT_USE_EPOLL
+static unsigned int
+epollEvents(int events)
+{
+  return ((events & GLUT_WATCH_READ) ? EPOLLIN : 0) |
+    ((events & GLUT_WATCH_WRITE) ? EPOLLOUT : 0);
+}
+
+static void
+epollControl(int op, int fd, int events)
+{
+  struct epoll_event event;
+
+  memset(&event, 0, sizeof(event));
+  event.events = epollEvents(events);
+  event.data.fd = fd;
+  if (epoll_ctl(epollFD, op, fd, &event) < 0 && op != EPOLL_CTL_DEL) {
+    __glutWarning("cannot watch file descriptor %d.", fd);
+  }
+}
+
+/* Registers everything known so far; later changes go straight to
+   epoll_ctl. */
+static void
+openEpoll(void)
+{
+  int fd;
+
+  epollFD = epoll_create1(EPOLL_CLOEXEC);
+  if (epollFD < 0) {
+    __glutFatalError("epoll_create1 failed.");
+  }
+  for (fd = 0; fd < watchTableSize; fd++) {
+    if (watchTable[fd].events) {
+      epollControl(EPOLL_CTL_ADD, fd, watchTable[fd].events);
+    }
+  }
+  if (wakeupFD[0] >= 0) {
+    epollControl(EPOLL_CTL_ADD, wakeupFD[0], GLUT_WATCH_READ);
+  }
+  /* Without a timerfd (Linux before 2.6.25), waits time out in
+     whole milliseconds. */
+  timerFD = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (timerFD >= 0) {
+    epollControl(EPOLL_CTL_ADD, timerFD, GLUT_WATCH_READ);
+  }
+}
+
+/* Arms the timerfd to expire at deadline, delta from now. */
+static void
+armTimer(GLUTnanoseconds deadline, GLUTnanoseconds delta)
+{
+  struct itimerspec spec;
+  int flags = 0;
+
+  memset(&spec, 0, sizeof(spec));
+  if (__glutClockSource == GLUT_CLOCK_MONOTONIC) {
+    /* GLUT's clock reads CLOCK_MONOTONIC itself, so the deadline
+       can be absolute and cannot drift however long it takes to
+       get into epoll_wait. */
+    spec.it_value.tv_sec = (time_t) (deadline / 1000000000);
+    spec.it_value.tv_nsec = (long) (deadline % 1000000000);
+    flags = TFD_TIMER_ABSTIME;
+  } else {
+    /* The TSC clock only approximates CLOCK_MONOTONIC, and a
+       program's clock need not follow it at all. */
+    spec.it_value.tv_sec = (time_t) (delta / 1000000000);
+    spec.it_value.tv_nsec = (long) (delta % 1000000000);
+  }
+  if (timerfd_settime(timerFD, flags, &spec, NULL) < 0) {
+    __glutFatalError("timerfd_settime failed.");
+  }
+  timerArmed = deadline;
+}
+# endif
+
+static void
+openWakeup(void)
+{
+# ifdef GLUT_USE_EPOLL
+  wakeupFD[0] = wakeupFD[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wakeupFD[0] < 0) {
+    __glutFatalError("eventfd failed.");
+  }
+  if (epollFD >= 0) {
+    epollControl(EPOLL_CTL_ADD, wakeupFD[0], GLUT_WATCH_READ);
+  }
+# else
+  if (pipe(wakeupFD) < 0) {
+    __glutFatalError("pipe failed.");
+  }
+  fcntl(wakeupFD[0], F_SETFL, fcntl(wakeupFD[0], F_GETFL) | O_NONBLOCK);
+  fcntl(wakeupFD[1], F_SETFL, fcntl(wakeupFD[1], F_GETFL) | O_NONBLOCK);
+# endif
+}
+
+static void
+drainWakeup(void)
+{
+  char buffer[64];
+
+  /* An eventfd reads as one 8 byte count; a pipe may hold
+     several bytes from wakeups racing the flag. */
+  while (read(wakeupFD[0], buffer, sizeof(buffer)) > 0) {
+  }
+}
+
+static void
+dispatch(int fd, int events)
+{
+  events &= watchTable[fd].events;
+  if (events) {
+    watchTable[fd].func(fd, events);
+  }
+}
+
+/* Blocks until the X connection is readable, a watched descriptor
+   is ready (running its callback), glutWakeup is called, a signal
+   arrives, or the clock reaches deadline (GLUT_WAIT_FOREVER for
+   never).  Returns zero when the main loop should look at its work
+   lists before reading X events again: callbacks ran, a wakeup
+   arrived, or a signal interrupted the wait. */
+int
+__glutWaitForEvents(GLUTnanoseconds deadline)
+{
+  GLUTnanoseconds now, delta = 0;
+  int rc, fd, handled = 0;
+# ifdef GLUT_USE_EPOLL
+  struct epoll_event ready[16];
+  int timeout, i;
+# else
+  struct timeval waittime;
+  fd_set readfds, writefds;
+  int maxfd;
+# endif
+
+  if (deadline != GLUT_WAIT_FOREVER) {
+    now = __glutClockNow();
+    if (deadline > now) {
+      delta = deadline - now;
+    }
+  }
+  /* Waits round up so the loop never wakes just short of the
+     deadline and spins until it arrives. */
+
+# ifdef GLUT_USE_EPOLL
+  if (epollFD < 0) {
+    openEpoll();
+  }
+  if (epollConnectionFD != __glutConnectionFD && __glutDisplay) {
+    epollConnectionFD = __glutConnectionFD;
+    epollControl(EPOLL_CTL_ADD, epollConnectionFD, GLUT_WATCH_READ);
+  }
+  if (deadline == GLUT_WAIT_FOREVER) {
+    timeout = -1;
+  } else if (delta == 0) {
+    timeout = 0;
+  } else if (timerFD >= 0) {
+    /* A timerfd left armed for an earlier deadline only costs a
+       spurious wakeup, so rearm only when the deadline moves. */
+    if (deadline != timerArmed) {
+      armTimer(deadline, delta);
+    }
+    timeout = -1;
+  } else {
+    timeout = (int) ((delta + 999999) / 1000000);
+  }
+  rc = epoll_wait(epollFD, ready, sizeof(ready) / sizeof(ready[0]), timeout);
+  if (rc < 0) {
+    if (errno == EINTR) {
+      return 0;
+    }
+    __glutFatalError("epoll_wait error.");
+  }
+  for (i = 0; i < rc; i++) {
+    unsigned int events = ready[i].events;
+
+    fd = ready[i].data.fd;
+    if (fd == epollConnectionFD) {
+      continue;
+    }
+    if (fd == timerFD) {
+      unsigned long long expirations;
+
+      /* Reached the deadline; that is a timeout, not an event. */
+      if (read(timerFD, &expirations, sizeof(expirations)) > 0) {
+        timerArmed = GLUT_WAIT_FOREVER;
+      }
+      continue;
+    }
+    handled = 1;
+    if (fd == wakeupFD[0]) {
+      drainWakeup();
+    } else if (fd < watchTableSize) {
+      /* Hang ups and errors show as whatever the callback
+         asked for, so its read or write sees them. */
+      dispatch(fd,
+        ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) ? GLUT_WATCH_READ : 0) |
+        ((events & (EPOLLOUT | EPOLLERR)) ? GLUT_WATCH_WRITE : 0));
+    }
+  }
+# else
+  FD_ZERO(&readfds);
+  FD_ZERO(&writefds);
+  maxfd = -1;
+  if (__glutDisplay) {
+    FD_SET(__glutConnectionFD, &readfds);
+    maxfd = __glutConnectionFD;
+  }
+  if (wakeupFD[0] >= 0) {
+    FD_SET(wakeupFD[0], &readfds);
+    if (wakeupFD[0] > maxfd) {
+      maxfd = wakeupFD[0];
+    }
+  }
+  for (fd = 0; fd < watchTableSize; fd++) {
+    if (watchTable[fd].events & GLUT_WATCH_READ) {
+      FD_SET(fd, &readfds);
+    }
+    if (watchTable[fd].events & GLUT_WATCH_WRITE) {
+      FD_SET(fd, &writefds);
+    }
+    if (watchTable[fd].events && fd > maxfd) {
+      maxfd = fd;
+    }
+  }
+  delta = (delta + 999) / 1000;  /* microseconds */
+  waittime.tv_sec = (long) (delta / 1000000);
+  waittime.tv_usec = (long) (delta % 1000000);
+  rc = select(maxfd + 1, &readfds, &writefds, NULL,
+    deadline == GLUT_WAIT_FOREVER ? NULL : &waittime);
+  if (rc < 0) {
+    if (errno == EINTR) {
+      return 0;
+    }
+    __glutFatalError("select error.");
+  }
+  if (rc > 0) {
+    if (wakeupFD[0] >= 0 && FD_ISSET(wakeupFD[0], &readfds)) {
+      drainWakeup();
+      handled = 1;
+    }
+    for (fd = 0; fd <= maxfd && fd < watchTableSize; fd++) {
+      int events = (FD_ISSET(fd, &readfds) ? GLUT_WATCH_READ : 0) |
+        (FD_ISSET(fd, &writefds) ? GLUT_WATCH_WRITE : 0);
+
+      if (events && watchTable[fd].events) {
+        dispatch(fd, events);
+        handled = 1;
+      }
+    }
+  }
+# endif
+  return !handled;
+}
+#endif /* !_WIN32 */
+
+/* Wakes the main loop unless it has been woken already and not
+   yet seen to it. */
+static void
+signalLoop(void)
+{
+  if (swapFlag(&__glutWakeupPending, 1)) {
+    return;
+  }
+#ifdef _WIN32
+  if (wakeupThread) {
+    PostThreadMessage(wakeupThread, WM_NULL, 0, 0);
+  }
+#else
+  if (wakeupFD[1] >= 0) {
+    int saved = errno;  /* glutWakeup may run in a signal handler */
+# ifdef GLUT_USE_EPOLL
+    unsigned long long one = 1;
+    ssize_t rc = write(wakeupFD[1], &one, sizeof(one));
+# else
+    ssize_t rc = write(wakeupFD[1], "", 1);
+# endif
+
+    (void) rc;  /* a full pipe already has the loop awake */
+    errno = saved;
+  }
+#endif
+}
+
+static void
+pushDeferred(GLUTdeferredCB func, void *data, int window)
+{
+  GLUTdeferred *deferred = (GLUTdeferred *) malloc(sizeof(GLUTdeferred));
+  GLUTdeferred *top;
+
+  if (!deferred) {
+    __glutFatalError("out of memory.");
+  }
+  deferred->func = func;
+  deferred->data = data;
+  deferred->window = window;
+  do {
+    top = deferredStack;
+    deferred->next = top;
+  } while (!comparePointer(&deferredStack, top, deferred));
+  signalLoop();
+}
+
+/* Only the main thread pops, and it takes the whole stack at once,
+   so a node cannot be popped and pushed again mid compare and swap
+   (the ABA problem).  The compare and swap is also a full barrier,
+   which keeps the clearing of __glutWakeupPending ahead of it. */
+static void
+runDeferred(void)
+{
+  GLUTdeferred *deferred, *oldest = NULL, *next;
+
+  do {
+    deferred = deferredStack;
+  } while (!comparePointer(&deferredStack, deferred, NULL));
+  while (deferred) {
+    next = deferred->next;
+    deferred->next = oldest;
+    oldest = deferred;
+    deferred = next;
+  }
+  while (oldest) {
+    deferred = oldest;
+    oldest = deferred->next;
+    if (deferred->func) {
+      deferred->func(deferred->data);
+    } else if (deferred->window <= __glutWindowListSize &&
+      __glutWindowList[deferred->window - 1]) {
+      /* The window may have been destroyed since the post. */
+      __glutPostRedisplay(__glutWindowList[deferred->window - 1],
+        GLUT_REDISPLAY_WORK);
+    }
+    free(deferred);
+  }
+}
+
+/* Clearing the flag first means work posted while this runs wakes
+   the loop again rather than being missed. */
+void
+__glutHandleWakeup(void)
+{
+  (void) swapFlag(&__glutWakeupPending, 0);
+  runDeferred();
+  if (swapFlag(&wakeupRequested, 0) && wakeupFunc) {
+    wakeupFunc();
+  }
+}
+
+/* Called from glutInit, so the wakeup exists before any other thread
+   can need it. */
+void
+__glutInitWakeup(void)
+{
+#ifdef _WIN32
+  wakeupThread = GetCurrentThreadId();
+#else
+  if (wakeupFD[0] < 0) {
+    openWakeup();
+  }
+#endif
+}
+
+/* CENTRY */
+int GLUTAPIENTRY
+glutWatchFd(int fd, int events, GLUTwatchCB watchFunc)
+{
+#ifdef _WIN32
+  return 0;
+#else
+  int was;
+
+  if (fd < 0 || (fd == __glutConnectionFD && __glutDisplay) ||
+    fd == wakeupFD[0]) {
+    return 0;
+  }
+  events &= GLUT_WATCH_READ | GLUT_WATCH_WRITE;
+  if (!watchFunc) {
+    events = 0;
+  }
+  if (fd >= watchTableSize) {
+    int size = watchTableSize ? watchTableSize : 16;
+    GLUTwatch *table;
+
+    if (!events) {
+      return 1;  /* was not watched */
+    }
+    while (size <= fd) {
+      size *= 2;
+    }
+    table = (GLUTwatch *) realloc(watchTable, size * sizeof(GLUTwatch));
+    if (!table) {
+      __glutFatalError("out of memory.");
+    }
+    memset(table + watchTableSize, 0,
+      (size - watchTableSize) * sizeof(GLUTwatch));
+    watchTable = table;
+    watchTableSize = size;
+  }
+  was = watchTable[fd].events;
+  watchTable[fd].func = watchFunc;
+  watchTable[fd].events = events;
+  __glutWatchCount += (events != 0) - (was != 0);
+# ifdef GLUT_USE_EPOLL
+  if (epollFD >= 0) {
+    if (!was && events) {
+      epollControl(EPOLL_CTL_ADD, fd, events);
+    } else if (was && !events) {
+      epollControl(EPOLL_CTL_DEL, fd, 0);
+    } else if (was != events) {
+      epollControl(EPOLL_CTL_MOD, fd, events);
+    }
+  }
+# endif
+  return 1;
+#endif
+}
+
+void GLUTAPIENTRY
+glutWakeupFunc(GLUTwakeupCB func)
+{
+  wakeupFunc = func;
+  if (func) {
+    __glutInitWakeup();
+  }
+}
+
+void GLUTAPIENTRY
+glutWakeup(void)
+{
+  /* Only the first of a burst of wakeups signals the loop; the
+     callback runs once for all of them. */
+  wakeupRequested = 1;
+  signalLoop();
+}
+
+void GLUTAPIENTRY
+glutRunOnMainLoop(GLUTdeferredCB func, void *data)
+{
+  if (func) {
+    pushDeferred(func, data, 0);
+  }
+}
+
+void GLUTAPIENTRY
+glutPostWindowRedisplayFromThread(int win)
+{
+  if (win > 0) {
+    pushDeferred(NULL, NULL, win);
+  }
+}
+/* ENDCENTRY */
@@ -25,6 +25,8 @@
 GLUTwindow *__glutCurrentWindow = NULL;
 GLUTwindow **__glutWindowList = NULL;
 int __glutWindowListSize = 0;
+int __glutContextSwitches = 0;
+int __glutContextSwitchesAvoided = 0;
 #if !defined(_WIN32)
 GLUTstale *__glutStaleWindowList = NULL;
 #endif
@@ -43,10 +45,9 @@ static int numRequiredWindowCriteria = sizeof(requiredWindowCriteria) / sizeof(C
 static int requiredWindowCriteriaMask = (1 << LEVEL) | (1 << TRANSPARENT);
 
 static void
-cleanWindowWorkList(GLUTwindow * window)
+cleanWorkList(GLUTwindow ** pEntry, GLUTwindow * window)
 {
-  GLUTwindow **pEntry = &__glutWindowWorkList;
-  GLUTwindow *entry = __glutWindowWorkList;
+  GLUTwindow *entry = *pEntry;
 
   /* Tranverse singly-linked window work list look for the
      window. */
@@ -62,6 +63,16 @@ cleanWindowWorkList(GLUTwindow * window)
   }
 }
 
+static void
+cleanWindowWorkList(GLUTwindow * window)
+{
+  /* The window may be waiting on the work list or, if a callback
+     of another window is destroying it, waiting its turn in the
+     work being processed. */
+  cleanWorkList(&__glutWindowWorkList, window);
+  cleanWorkList(&__glutWindowWorkPending, window);
+}
+
 #if !defined(_WIN32)
 
 static void
@@ -92,7 +103,7 @@ static GLUTwindow *__glutWindowCache = NULL;
 GLUTwindow *
 __glutGetWindow(Window win)
 {
-  int i;
+  GLUTwindow *window;
 
   /* Does win belong to the last window ID looked up? */
   if (__glutWindowCache && (win == __glutWindowCache->win ||
@@ -100,20 +111,11 @@ __glutGetWindow(Window win)
         __glutWindowCache->overlay->win))) {
     return __glutWindowCache;
   }
-  /* Otherwise scan the window list looking for the window ID. */
-  for (i = 0; i < __glutWindowListSize; i++) {
-    if (__glutWindowList[i]) {
-      if (win == __glutWindowList[i]->win) {
-        __glutWindowCache = __glutWindowList[i];
-        return __glutWindowCache;
-      }
-      if (__glutWindowList[i]->overlay) {
-        if (win == __glutWindowList[i]->overlay->win) {
-          __glutWindowCache = __glutWindowList[i];
-          return __glutWindowCache;
-        }
-      }
-    }
+  /* Otherwise look the window ID up in the window hash. */
+  window = __glutLookupWindow(win);
+  if (window) {
+    __glutWindowCache = window;
+    return window;
   }
 #if !defined(_WIN32)
   {
@@ -151,12 +153,23 @@ __glutSetWindow(GLUTwindow * window)
      to a window we are already current to.  In fact, this
      assumption breaks when GLUT is expected to integrated with
      other OpenGL windowing APIs that also make current to
-     OpenGL contexts.  Since glXMakeCurrent short-circuits the
-     "already bound" case, GLUT avoids the temptation to do so
-     too. */
+     OpenGL contexts.  So rather than trust __glutCurrentWindow,
+     ask OpenGL what is current; that is a client side query,
+     while even an "already bound" make current can cost a
+     flush and a trip through the driver.  The work list
+     typically sets the same window several times in a row
+     (reshape, display, finish), and a single window program
+     stays current from one frame to the next. */
   __glutCurrentWindow = window;
 
-  MAKE_CURRENT_LAYER(__glutCurrentWindow);
+  if (__glutNullWindowSystem && !__glutUseEGL) {
+    /* No OpenGL contexts to make current. */
+  } else if (IS_CURRENT_LAYER(__glutCurrentWindow)) {
+    __glutContextSwitchesAvoided++;
+  } else {
+    MAKE_CURRENT_LAYER(__glutCurrentWindow);
+    __glutContextSwitches++;
+  }
 
 #if !defined(_WIN32)
   /* We should be careful to force a finish between each
@@ -505,7 +518,7 @@ __glutCreateWindow(GLUTwindow * parent,
     __glutOpenWin32Connection(NULL);
   }
 #else
-  if (!__glutDisplay) {
+  if (!__glutDisplay && !__glutNullWindowSystem) {
     __glutOpenXConnection(NULL);
   }
 #endif
@@ -520,13 +533,22 @@ __glutCreateWindow(GLUTwindow * parent,
   window->num = winnum;
 
 #if !defined(_WIN32)
-  window->vis = __glutDetermineWindowVisual(&window->treatAsSingle,
-    &window->visAlloced, (void**) &fbc);
-  if (!window->vis) {
-    __glutFatalError(
-      "visual with necessary capabilities not found.");
+  if (__glutNullWindowSystem) {
+    window->vis = NULL;
+    window->visAlloced = False;
+    window->treatAsSingle = False;
+    window->colormap = NULL;
+    window->cmap = 0;
+    fbc = NULL;
+  } else {
+    window->vis = __glutDetermineWindowVisual(&window->treatAsSingle,
+      &window->visAlloced, (void**) &fbc);
+    if (!window->vis) {
+      __glutFatalError(
+        "visual with necessary capabilities not found.");
+    }
+    __glutSetupColormap(window->vis, &window->colormap, &window->cmap);
   }
-  __glutSetupColormap(window->vis, &window->colormap, &window->cmap);
 #endif
   window->eventMask = StructureNotifyMask | ExposureMask;
 
@@ -596,13 +618,28 @@ __glutCreateWindow(GLUTwindow * parent,
   }
   window->renderDc = window->hdc;
 #else /* X Window System */
-  window->win = XCreateWindow(__glutDisplay,
-    parent == NULL ? __glutRoot : parent->win,
-    x, y, width, height, 0,
-    window->vis->depth, InputOutput, window->vis->visual,
-    attribMask, &wa);
+  if (__glutNullWindowSystem) {
+    window->win = __glutNullCreateWindow(
+      parent == NULL ? __glutRoot : parent->win,
+      x, y, width, height);
+  } else {
+    window->win = XCreateWindow(__glutDisplay,
+      parent == NULL ? __glutRoot : parent->win,
+      x, y, width, height, 0,
+      window->vis->depth, InputOutput, window->vis->visual,
+      attribMask, &wa);
+  }
 #endif
+  __glutHashWindow(window->win, window);
   window->renderWin = window->win;
+#if !defined(_WIN32)
+  if (__glutNullWindowSystem) {
+    /* Without -egl, callbacks run with no context current. */
+    window->eglSurface = NULL;
+    window->ctx = __glutUseEGL ?
+      __glutEGLCreateContext(window, width, height) : NULL;
+  } else
+#endif
 #if defined(GLX_VERSION_1_1) && defined(GLX_SGIX_fbconfig)
   if (fbc) {
     window->ctx = glXCreateContextWithConfigSGIX(__glutDisplay, fbc,
@@ -617,13 +654,14 @@ __glutCreateWindow(GLUTwindow * parent,
       None, __glutTryDirect);
 #endif
   }
-  if (!window->ctx) {
+  if (!window->ctx && !__glutNullWindowSystem) {
     __glutFatalError(
       "failed to create OpenGL rendering context.");
   }
   window->renderCtx = window->ctx;
 #if !defined(_WIN32)
-  window->isDirect = glXIsDirect(__glutDisplay, window->ctx);
+  window->isDirect = __glutNullWindowSystem ||
+    glXIsDirect(__glutDisplay, window->ctx);
   if (__glutForceDirect) {
     if (!window->isDirect) {
       __glutFatalError("direct rendering not possible.");
@@ -706,6 +744,9 @@ __glutCreateWindow(GLUTwindow * parent,
   /* Make the new window the current window. */
   __glutSetWindow(window);
 
+  if (__glutNullWindowSystem) {
+    return window;
+  }
   __glutDetermineMesaSwapHackSupport();
 
   if (window->treatAsSingle) {
@@ -762,17 +803,24 @@ glutCreateWindow(const char *title)
     window->desiredMapState = IconicState;
   }
 #else
-  wmHints = XAllocWMHints();
-  wmHints->initial_state =
-    __glutIconic ? IconicState : NormalState;
-  wmHints->flags = StateHint;
-  XSetWMProperties(__glutDisplay, win, &textprop, &textprop,
-  /* Only put WM_COMMAND property on first window. */
-    firstWindow ? __glutArgv : NULL,
-    firstWindow ? __glutArgc : 0,
-    &__glutSizeHints, wmHints, NULL);
-  XFree(wmHints);
-  XSetWMProtocols(__glutDisplay, win, &__glutWMDeleteWindow, 1);
+  if (__glutNullWindowSystem) {
+    /* No window manager to hint; just honor -iconic. */
+    if (__glutIconic) {
+      window->desiredMapState = IconicState;
+    }
+  } else {
+    wmHints = XAllocWMHints();
+    wmHints->initial_state =
+      __glutIconic ? IconicState : NormalState;
+    wmHints->flags = StateHint;
+    XSetWMProperties(__glutDisplay, win, &textprop, &textprop,
+    /* Only put WM_COMMAND property on first window. */
+      firstWindow ? __glutArgv : NULL,
+      firstWindow ? __glutArgc : 0,
+      &__glutSizeHints, wmHints, NULL);
+    XFree(wmHints);
+    XSetWMProtocols(__glutDisplay, win, &__glutWMDeleteWindow, 1);
+  }
 #endif
   firstWindow = 0;
   return window->num + 1;
@@ -829,7 +877,9 @@ __glutDestroyWindow(GLUTwindow * window,
   }
   /* Unbind if bound to this window. */
   if (window == __glutCurrentWindow) {
-    UNMAKE_CURRENT();
+    if (!__glutNullWindowSystem || __glutUseEGL) {
+      UNMAKE_CURRENT();
+    }
     __glutCurrentWindow = NULL;
   }
   /* Invalidate glutExtensionSupported string cache if needed. */
@@ -839,8 +889,19 @@ __glutDestroyWindow(GLUTwindow * window,
     __glutInvalidateExtensionStringCacheIfNeeded(window->overlay->ctx);
     __glutFreeOverlayFunc(window->overlay);
   }
-  XDestroyWindow(__glutDisplay, window->win);
-  glXDestroyContext(__glutDisplay, window->ctx);
+  __glutUnhashWindow(window->win);
+#if !defined(_WIN32)
+  if (__glutNullWindowSystem) {
+    __glutNullDestroyWindow(window->win);
+    if (__glutUseEGL) {
+      __glutEGLDestroyContext(window);
+    }
+  } else
+#endif
+  {
+    XDestroyWindow(__glutDisplay, window->win);
+    glXDestroyContext(__glutDisplay, window->ctx);
+  }
   if (window->colormap) {
     /* Only color index windows have colormap data structure. */
     __glutFreeColormap(window->colormap);
@@ -893,7 +954,9 @@ glutDestroyWindow(int win)
   }
 #endif
   __glutDestroyWindow(window, window);
-  XFlush(__glutDisplay);
+  if (!__glutNullWindowSystem) {
+    XFlush(__glutDisplay);
+  }
 }
 /* ENDCENTRY */
 
@@ -0,0 +1,248 @@
+
+/* Copyright (c) Mark J. Kilgard, 2026. */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* Maps window system window IDs, of GLUT windows and of their
+   overlays, to GLUT windows, so __glutGetWindow finds the window
+   for an event in constant time however many windows there are.
+   The table is open addressed with linear probing, kept at most
+   half full, and deletes by shifting later entries of a probe run
+   back rather than leaving tombstones. */
+
+#include <stdlib.h>
+
+#include "glutint.h"
+
+static Window *hashKeys = NULL;       /* 0 marks an empty slot */
+static GLUTwindow **hashWindows = NULL;
+static int hashSize = 0;              /* a power of two */
+static int hashCount = 0;
+static int hashShift = 32;
+
+/* X allocates window IDs consecutively and Win32 HWNDs are
+   aligned, so multiply by 2^32 over the golden ratio and keep the
+   high bits, which every bit of the ID affects. */
+static int
+hashSlot(Window win)
+{
+  unsigned int key = (unsigned int) (size_t) win;
+
+  return (int) ((key * 2654435761u) >> hashShift);
+}
+
+static void
+insert(Window win, GLUTwindow * window)
+{
+  int i = hashSlot(win);
+
+  while (hashKeys[i]) {
+    i = (i + 1) & (hashSize - 1);
+  }
+  hashKeys[i] = win;
+  hashWindows[i] = window;
+}
+
+static void
+resize(int size)
+{
+  Window *keys = hashKeys;
+  GLUTwindow **windows = hashWindows;
+  int oldSize = hashSize, i;
+
+  hashKeys = (Window *) calloc(size, sizeof(Window));
+  hashWindows = (GLUTwindow **) malloc(size * sizeof(GLUTwindow *));
+  if (!hashKeys || !hashWindows) {
+    __glutFatalError("out of memory.");
+  }
+  hashSize = size;
+  for (hashShift = 32; size > 1; size >>= 1) {
+    hashShift--;
+  }
+  for (i = 0; i < oldSize; i++) {
+    if (keys[i]) {
+      insert(keys[i], windows[i]);
+    }
+  }
+  free(keys);
+  free(windows);
+}
+
+void
+__glutHashWindow(Window win, GLUTwindow * window)
+{
+  if (2 * (hashCount + 1) > hashSize) {
+    resize(hashSize ? 2 * hashSize : 64);
+  }
+  insert(win, window);
+  hashCount++;
+}
+
+GLUTwindow *
+__glutLookupWindow(Window win)
+{
+  int i;
+
+  if (!hashSize || !win) {
+    return NULL;
+  }
+  for (i = hashSlot(win); hashKeys[i]; i = (i + 1) & (hashSize - 1)) {
+    if (hashKeys[i] == win) {
+      return hashWindows[i];
+    }
+  }
+  return NULL;
+}
+
+void
+__glutUnhashWindow(Window win)
+{
+  int mask = hashSize - 1;
+  int i, j, home;
+
+  if (!hashSize || !win) {
+    return;
+  }
+  for (i = hashSlot(win); hashKeys[i] != win; i = (i + 1) & mask) {
+    if (!hashKeys[i]) {
+      return;
+    }
+  }
+  hashCount--;
+  /* Fill the hole at i with the next entry in the run that may
+     live there (its home slot is not cyclically within (i, j]),
+     then fill the hole that leaves, until the run ends. */
+  for (j = i;;) {
+    j = (j + 1) & mask;
+    if (!hashKeys[j]) {
+      break;
+    }
+    home = hashSlot(hashKeys[j]);
+    if (i <= j ? (home <= i || home > j) : (home <= i && home > j)) {
+      hashKeys[i] = hashKeys[j];
+      hashWindows[i] = hashWindows[j];
+      i = j;
+    }
+  }
+  hashKeys[i] = 0;
+  hashWindows[i] = NULL;
+}
+
+#ifdef TEST
+
+/* Microbenchmark: times finding the window for an event among 1,000
+   to 10,000 windows, each with an overlay, by hash and by the scan
+   of the window list __glutGetWindow used to do. */
+
+#include <stdio.h>
+
+#define LOOKUPS 1000000
+
+char *__glutProgramName = "winhash";  /* normally glut_init.c's */
+
+static GLUTwindow **windowList;
+static int windowListSize;
+
+static GLUTwindow *
+scanWindowList(Window win)
+{
+  int i;
+
+  for (i = 0; i < windowListSize; i++) {
+    if (windowList[i]) {
+      if (win == windowList[i]->win) {
+        return windowList[i];
+      }
+      if (windowList[i]->overlay && win == windowList[i]->overlay->win) {
+        return windowList[i];
+      }
+    }
+  }
+  return NULL;
+}
+
+/* The ID of the nth window X creates, from a typical client base. */
+static Window
+windowID(int n)
+{
+  return (Window) (size_t) (0x3a00001 + n);
+}
+
+int
+main(int argc, char **argv)
+{
+  static int sizes[] = { 1000, 3000, 10000 };
+  static Window events[LOOKUPS];
+  GLUTnanoseconds start, hashed, scanned;
+  int i, s, n, wrong = 0;
+
+  __glutInitClock(0);
+  __glutProgramName = argv[0];
+  srand(1);
+  printf("%8s %14s %14s\n", "windows", "hash ns/event", "scan ns/event");
+  for (s = 0; s < (int) (sizeof(sizes) / sizeof(sizes[0])); s++) {
+    n = sizes[s];
+    windowList = (GLUTwindow **) calloc(n, sizeof(GLUTwindow *));
+    for (i = 0; i < n; i++) {
+      GLUTwindow *window = (GLUTwindow *) calloc(1, sizeof(GLUTwindow));
+
+      window->num = i;
+      window->win = windowID(2 * i);
+      window->overlay = (GLUToverlay *) calloc(1, sizeof(GLUToverlay));
+      window->overlay->win = windowID(2 * i + 1);
+      windowList[i] = window;
+      __glutHashWindow(window->win, window);
+      __glutHashWindow(window->overlay->win, window);
+    }
+    windowListSize = n;
+    for (i = 0; i < LOOKUPS; i++) {
+      events[i] = windowID(rand() % (2 * n));
+    }
+
+    start = __glutClockNow();
+    for (i = 0; i < LOOKUPS; i++) {
+      wrong += __glutLookupWindow(events[i]) == NULL;
+    }
+    hashed = __glutClockNow() - start;
+
+    start = __glutClockNow();
+    for (i = 0; i < LOOKUPS / 100; i++) {
+      wrong += scanWindowList(events[i]) == NULL;
+    }
+    scanned = (__glutClockNow() - start) * 100;
+
+    printf("%8d %14.1f %14.1f\n", n,
+      (double) hashed / LOOKUPS, (double) scanned / LOOKUPS);
+
+    /* Unhash every other window, check the rest still resolve and
+       the removed do not, then empty the table for the next size. */
+    for (i = 0; i < n; i += 2) {
+      __glutUnhashWindow(windowList[i]->win);
+      __glutUnhashWindow(windowList[i]->overlay->win);
+    }
+    for (i = 0; i < n; i++) {
+      GLUTwindow *expect = i % 2 ? windowList[i] : NULL;
+
+      wrong += __glutLookupWindow(windowList[i]->win) != expect;
+      wrong += __glutLookupWindow(windowList[i]->overlay->win) != expect;
+    }
+    for (i = 0; i < n; i++) {
+      __glutUnhashWindow(windowList[i]->win);
+      __glutUnhashWindow(windowList[i]->overlay->win);
+      free(windowList[i]->overlay);
+      free(windowList[i]);
+    }
+    free(windowList);
+    if (hashCount != 0) {
+      wrong++;
+    }
+  }
+  if (wrong) {
+    printf("FAILED: %d wrong lookups\n", wrong);
+    return 1;
+  }
+  return 0;
+}
+#endif /* TEST */
@@ -31,6 +31,9 @@ glutSetWindowTitle(const char *title)
   textprop.encoding = XA_STRING;
   textprop.format = 8;
   textprop.nitems = (unsigned long)strlen(title);
+  if (__glutNullWindowSystem) {
+    return;
+  }
   XSetWMName(__glutDisplay,
     __glutCurrentWindow->win, &textprop);
   XFlush(__glutDisplay);
@@ -48,6 +51,9 @@ glutSetIconTitle(const char *title)
   textprop.encoding = XA_STRING;
   textprop.format = 8;
   textprop.nitems = (unsigned long)strlen(title);
+  if (__glutNullWindowSystem) {
+    return;
+  }
   XSetWMIconName(__glutDisplay,
     __glutCurrentWindow->win, &textprop);
   XFlush(__glutDisplay);
@@ -11,19 +11,25 @@
                                the GLUT library itself. */
 #include <GL/glut.h>
 
+/* Glyph metrics are small enough for bytes, and the glyph's
+   bitmap is named by its byte offset into the font's bitmaps
+   array rather than by pointer, so a font's tables need no
+   relocations. A glyph with zero width and zero advance is
+   missing from the font. */
 typedef struct {
-  const GLsizei width;
-  const GLsizei height;
-  const GLfloat xorig;
-  const GLfloat yorig;
-  const GLfloat advance;
-  const GLubyte *bitmap;
+  const GLubyte width;
+  const GLubyte height;
+  const GLbyte xorig;
+  const GLbyte yorig;
+  const GLubyte advance;
+  const GLuint offset;
 } BitmapCharRec, *BitmapCharPtr;
 
 typedef struct {
   const int num_chars;
   const int first;
-  const BitmapCharRec * const *ch;
+  const BitmapCharRec *ch;
+  const GLubyte *bitmaps;
 } BitmapFontRec, *BitmapFontPtr;
 
 typedef void *GLUTbitmapFont;
@@ -87,30 +87,7 @@ extern int sys$gettim(struct timeval *);
 # endif
 #endif
 #if defined(__vms) && ( __VMS_VER < 70000000 )
-
-/* For VMS6.2 or lower :
-   One TICK on VMS is 100 nanoseconds; 0.1 microseconds or
-   0.0001 milliseconds. This means that there are 0.01
-   ticks/ns, 10 ticks/us, 10,000 ticks/ms and 10,000,000
-   ticks/second. */
-
-# define TICKS_PER_MILLISECOND 10000
-# define TICKS_PER_SECOND      10000000
-
 # define GETTIMEOFDAY(_x) (void) sys$gettim (_x);
-
-# define ADD_TIME(dest, src1, src2) { \
-  (dest).val = (src1).val + (src2).val; \
-}
-
-# define TIMEDELTA(dest, src1, src2) { \
-  (dest).val = (src1).val - (src2).val; \
-}
-
-# define IS_AFTER(t1, t2) ((t2).val > (t1).val)
-
-# define IS_AT_OR_AFTER(t1, t2) ((t2).val >= (t1).val)
-
 #else
 # ifdef _WIN32
 #  define GETTIMEOFDAY(_x) gettimeofdayWIN32(_x)
@@ -122,34 +99,6 @@ extern int sys$gettim(struct timeval *);
 #   define GETTIMEOFDAY(_x) gettimeofday(_x, NULL)
 #  endif
 # endif
-# define ADD_TIME(dest, src1, src2) { \
-  if(((dest).tv_usec = \
-    (src1).tv_usec + (src2).tv_usec) >= 1000000) { \
-    (dest).tv_usec -= 1000000; \
-    (dest).tv_sec = (src1).tv_sec + (src2).tv_sec + 1; \
-  } else { \
-    (dest).tv_sec = (src1).tv_sec + (src2).tv_sec; \
-    if(((dest).tv_sec >= 1) && (((dest).tv_usec <0))) { \
-      (dest).tv_sec --;(dest).tv_usec += 1000000; \
-    } \
-  } \
-}
-# define TIMEDELTA(dest, src1, src2) { \
-  if(((dest).tv_usec = (src1).tv_usec - (src2).tv_usec) < 0) { \
-    (dest).tv_usec += 1000000; \
-    (dest).tv_sec = (src1).tv_sec - (src2).tv_sec - 1; \
-  } else { \
-     (dest).tv_sec = (src1).tv_sec - (src2).tv_sec; \
-  } \
-}
-# define IS_AFTER(t1, t2) \
-  (((t2).tv_sec > (t1).tv_sec) || \
-  (((t2).tv_sec == (t1).tv_sec) && \
-  ((t2).tv_usec > (t1).tv_usec)))
-# define IS_AT_OR_AFTER(t1, t2) \
-  (((t2).tv_sec > (t1).tv_sec) || \
-  (((t2).tv_sec == (t1).tv_sec) && \
-  ((t2).tv_usec >= (t1).tv_usec)))
 #endif
 
 #define IGNORE_IN_GAME_MODE() \
@@ -296,6 +245,9 @@ typedef void (GLUTCALLBACK *GLUTvisibilityCB) (int);
 typedef void (GLUTCALLBACK *GLUTwindowStatusCB) (int);
 typedef void (GLUTCALLBACK *GLUTidleCB) (void);
 typedef void (GLUTCALLBACK *GLUTtimerCB) (int);
+typedef void (GLUTCALLBACK *GLUTwatchCB) (int, int);
+typedef void (GLUTCALLBACK *GLUTwakeupCB) (void);
+typedef void (GLUTCALLBACK *GLUTdeferredCB) (void *);
 typedef void (GLUTCALLBACK *GLUTmenuStateCB) (int);  /* DEPRICATED. */
 typedef void (GLUTCALLBACK *GLUTmenuStatusCB) (int, int, int);
 typedef void (GLUTCALLBACK *GLUTselectCB) (int);
@@ -370,6 +322,7 @@ struct _GLUTwindow {
   Bool forceReshape;    /* force reshape before display */
 #if !defined(_WIN32)
   Bool isDirect;        /* if direct context (X11 only) */
+  void *eglSurface;     /* EGL pbuffer (glutInit -egl only) */
 #endif
   Bool usedSwapBuffers; /* if swap buffers used last display */
   long eventMask;       /* mask of X events selected for */
@@ -537,16 +490,15 @@ struct _GLUTmenuItem {
   GLUTmenuItem *next;   /* next menu entry on list for menu */
 };
 
-#ifdef _WIN32
-typedef struct timevalWIN32 GLUTtimeval;
-#else
-typedef struct timeval GLUTtimeval;
-#endif
-
 typedef struct _GLUTtimer GLUTtimer;
 struct _GLUTtimer {
-  GLUTtimer *next;      /* list of timers */
-  GLUTtimeval timeout;  /* time to be called */
+  GLUTtimer *next;      /* list of free timers */
+  GLUTnanoseconds timeout;  /* __glutClockNow time to be called */
+  GLUTnanoseconds slack;    /* how much later it may be called */
+  unsigned int order;   /* scheduling order; breaks deadline ties */
+  int heapIndex;        /* position in __glutTimerHeap, or -1 */
+  int slot;             /* position in the table of all timers */
+  int id;               /* glutScheduleTimer handle */
   GLUTtimerCB func;     /* timer  (value) */
   int value;            /*  return value */
 #ifdef SUPPORT_FORTRAN
@@ -599,6 +551,9 @@ typedef struct {
   }
 #define MAKE_CURRENT_OVERLAY(overlay) \
   wglMakeCurrent(overlay->hdc, overlay->ctx)
+#define IS_CURRENT_LAYER(window) \
+  (wglGetCurrentContext() == window->renderCtx \
+    && wglGetCurrentDC() == window->renderDc)
 #define UNMAKE_CURRENT() \
   wglMakeCurrent(NULL, NULL)
 #define SWAP_BUFFERS_WINDOW(window) \
@@ -608,30 +563,56 @@ typedef struct {
 #define GET_CURRENT_CONTEXT() \
   wglGetCurrentContext()
 #else
+/* With glutInit -egl, windows have no overlays, so their layer is
+   always the window itself. */
 #define MAKE_CURRENT_LAYER(window) \
-  glXMakeCurrent(__glutDisplay, window->renderWin, window->renderCtx)
+  (__glutUseEGL ? __glutEGLMakeCurrent(window) : \
+    glXMakeCurrent(__glutDisplay, window->renderWin, window->renderCtx))
 #define MAKE_CURRENT_WINDOW(window) \
-  glXMakeCurrent(__glutDisplay, window->win, window->ctx)
+  (__glutUseEGL ? __glutEGLMakeCurrent(window) : \
+    glXMakeCurrent(__glutDisplay, window->win, window->ctx))
 #define MAKE_CURRENT_OVERLAY(overlay) \
   glXMakeCurrent(__glutDisplay, overlay->win, overlay->ctx)
+#define IS_CURRENT_LAYER(window) \
+  (__glutUseEGL ? __glutEGLIsCurrent(window) : \
+    (glXGetCurrentContext() == window->renderCtx \
+      && glXGetCurrentDrawable() == window->renderWin))
 #define UNMAKE_CURRENT() \
-  glXMakeCurrent(__glutDisplay, None, NULL)
+  (__glutUseEGL ? __glutEGLMakeCurrent(NULL) : \
+    glXMakeCurrent(__glutDisplay, None, NULL))
 #define SWAP_BUFFERS_WINDOW(window) \
-  glXSwapBuffers(__glutDisplay, window->win)
+  (__glutUseEGL ? __glutEGLSwapBuffers(window) : \
+    glXSwapBuffers(__glutDisplay, window->win))
 #define SWAP_BUFFERS_LAYER(window) \
-  glXSwapBuffers(__glutDisplay, window->renderWin)
+  (__glutUseEGL ? __glutEGLSwapBuffers(window) : \
+    glXSwapBuffers(__glutDisplay, window->renderWin))
 #define GET_CURRENT_CONTEXT() \
-  glXGetCurrentContext()
+  (__glutUseEGL ? __glutEGLGetCurrentContext() : \
+    glXGetCurrentContext())
 #endif
 
 /* private variables from glut_event.c */
 extern GLUTwindow *__glutWindowWorkList;
+extern GLUTwindow *__glutWindowWorkPending;
 extern int __glutWindowDamaged;
+extern GLUTmenu *__glutMappedMenu;
+extern int __glutCoalescedMotion;
+extern int __glutCoalescedReshape;
+
+/* private variables from glut_timer.c */
+extern GLUTtimer **__glutTimerHeap;  /* earliest deadline first */
+extern int __glutTimerCount;
+extern GLUTtimer *__glutCurrentTimer;  /* one whose callback is running */
 #ifdef SUPPORT_FORTRAN
-extern GLUTtimer *__glutTimerList;
 extern GLUTtimer *__glutNewTimer;
 #endif
-extern GLUTmenu *__glutMappedMenu;
+
+/* private variables from glut_clock.c */
+extern int __glutClockSource;
+
+/* private variables from glut_watch.c */
+extern int __glutWatchCount;
+extern volatile int __glutWakeupPending;
 
 extern void (*__glutUpdateInputDeviceMaskFunc) (GLUTwindow *);
 #if !defined(_WIN32)
@@ -693,6 +674,8 @@ extern GLUTwindow *__glutCurrentWindow;
 extern GLUTwindow *__glutMenuWindow;
 extern GLUTmenu *__glutCurrentMenu;
 extern int __glutWindowListSize;
+extern int __glutContextSwitches;
+extern int __glutContextSwitchesAvoided;
 extern void (*__glutFreeOverlayFunc) (GLUToverlay *);
 extern XVisualInfo *__glutDetermineWindowVisual(Bool * treatAsSingle,
   Bool * visAlloced, void **fbc);
@@ -700,6 +683,12 @@ extern XVisualInfo *__glutDetermineWindowVisual(Bool * treatAsSingle,
 /* private variables from glut_mesa.c */
 extern int __glutMesaSwapHackSupport;
 
+/* private variables from glut_null.c */
+extern GLboolean __glutNullWindowSystem;
+
+/* private variables from glut_egl.c */
+extern GLboolean __glutUseEGL;
+
 /* private variables from glut_gamemode.c */
 extern GLUTwindow *__glutGameModeWindow;
 
@@ -733,12 +722,66 @@ extern void __glutInvalidateExtensionStringCacheIfNeeded(GLXContext ctx);
 /* private routines from glut_init.c */
 #if !defined(_WIN32)
 extern void __glutOpenXConnection(char *display);
-extern void __glutInitTime(struct timeval *beginning);
 #else
 extern void __glutOpenWin32Connection(char *display);
-extern DWORD __glutInitTime(void);
 #endif
 
+/* private routines from glut_null.c */
+#if !defined(_WIN32)
+extern void __glutNullOpenConnection(void);
+extern Window __glutNullCreateWindow(Window parent, int x, int y,
+  int width, int height);
+extern void __glutNullDestroyWindow(Window win);
+extern void __glutNullWindowWork(GLUTwindow * window, int workMask);
+extern int __glutNullGet(GLenum param, int *value);
+extern int __glutNullEventsQueued(void);
+extern void __glutNullPeekEvent(XEvent * event);
+extern void __glutNullNextEvent(XEvent * event);
+extern int __glutNullLookupString(XKeyEvent * event, char *buffer);
+extern KeySym __glutNullLookupKeysym(XKeyEvent * event);
+extern void __glutNullWarpPointer(GLUTwindow * window, int x, int y);
+#endif
+
+/* private routines from glut_egl.c */
+#if !defined(_WIN32)
+extern void __glutEGLOpenDisplay(void);
+extern GLXContext __glutEGLCreateContext(GLUTwindow * window,
+  int width, int height);
+extern void __glutEGLDestroyContext(GLUTwindow * window);
+extern void __glutEGLResizeWindow(GLUTwindow * window);
+extern int __glutEGLMakeCurrent(GLUTwindow * window);
+extern int __glutEGLIsCurrent(GLUTwindow * window);
+extern GLXContext __glutEGLGetCurrentContext(void);
+extern void __glutEGLSwapBuffers(GLUTwindow * window);
+extern int __glutEGLGet(GLenum param, int *value);
+#endif
+
+/* private routines from glut_clock.c */
+extern void __glutInitClock(int source);
+extern GLUTnanoseconds __glutClockNow(void);
+extern void __glutAdvanceClockTo(GLUTnanoseconds deadline);
+extern GLUTnanoseconds __glutClockGenesis(void);
+extern GLUTnanoseconds __glutProcessTime(void);
+
+/* private routines from glut_timer.c */
+extern int __glutScheduleTimer(GLUTnanoseconds timeout,
+  GLUTnanoseconds slack, GLUTtimerCB timerFunc, int value);
+extern GLUTnanoseconds __glutTimerDeadline(void);
+extern void __glutHandleTimeouts(void);
+
+/* private routines from glut_watch.c */
+#define GLUT_WAIT_FOREVER (~(GLUTnanoseconds) 0)
+#ifndef _WIN32
+extern int __glutWaitForEvents(GLUTnanoseconds deadline);
+#endif
+extern void __glutHandleWakeup(void);
+extern void __glutInitWakeup(void);
+
+/* private routines from glut_winhash.c */
+extern void __glutHashWindow(Window win, GLUTwindow * window);
+extern void __glutUnhashWindow(Window win);
+extern GLUTwindow *__glutLookupWindow(Window win);
+
 /* private routines for glut_menu.c (or win32_menu.c) */
 #if defined(_WIN32)
 extern GLUTmenu *__glutGetMenuByNum(int menunum);
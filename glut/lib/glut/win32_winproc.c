@@ -58,8 +58,6 @@ MMRESULT WINAPI joySetThreshold(UINT uJoyID, UINT uThreshold);
 
 extern unsigned __glutMenuButton;
 extern GLUTidleCB __glutIdleFunc;
-extern GLUTtimer *__glutTimerList;
-extern void handleTimeouts(void);
 extern GLUTmenuItem *__glutGetUniqueMenuItem(GLUTmenu * menu, int unique);
 static HMENU __glutHMenu;
 
@@ -545,8 +543,8 @@ __glutWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
        __glutIdleFunc();
      }
 #endif
-    if (__glutTimerList) {
-      handleTimeouts();
+    if (__glutTimerCount) {
+      __glutHandleTimeouts();
     }
     return 0;
 
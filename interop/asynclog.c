@@ -0,0 +1,433 @@
+
+/* asynclog.c - deferred-formatting logger drained by a background thread */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>  /* for CreateThread and Interlocked operations */
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "asynclog.h"
+
+#ifdef _WIN32
+#define snprintf _snprintf
+#endif
+
+// Bounded multi-producer ring after Dmitry Vyukov's MPMC queue: a
+// slot's sequence equals its position when free and position+1 once
+// its message is written.
+typedef struct _AsyncLogRecord {
+    volatile unsigned int sequence;
+    unsigned int arg_count;   // conversions whose arguments were captured
+    const char *prefix;
+    const char *format;
+    unsigned char arg[ASYNC_LOG_ARG_BYTES];
+} AsyncLogRecord;
+
+static AsyncLogRecord ring[ASYNC_LOG_RECORDS];
+static volatile unsigned int head = 0;
+static unsigned int tail = 0;  // only the drain thread touches this
+static volatile unsigned int dropped = 0;
+static volatile int running = 0;
+static volatile int stopping = 0;
+static FILE *out = NULL;
+
+#ifdef _WIN32
+static HANDLE thread;
+#define barrier() MemoryBarrier()
+#define compareAndSwap(p, old, new) \
+    (InterlockedCompareExchange((volatile LONG*)(p), (LONG)(new), (LONG)(old)) == (LONG)(old))
+#define atomicIncrement(p) InterlockedIncrement((volatile LONG*)(p))
+#else
+static pthread_t thread;
+#define barrier() __sync_synchronize()
+#define compareAndSwap(p, old, new) __sync_bool_compare_and_swap(p, old, new)
+#define atomicIncrement(p) __sync_add_and_fetch(p, 1)
+#endif
+
+typedef enum {
+    ARG_NONE,    // "%%" or unsupported conversion
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_SIZE,
+    ARG_DOUBLE,
+    ARG_POINTER,
+    ARG_STRING
+} ArgKind;
+
+// Scans the printf conversion following a '%'; returns the character
+// after it, or NULL at a malformed end of string.
+static const char *scanConversion(const char *f, ArgKind *kind, int *stars)
+{
+    int length = 0;  // 0 int, 1 long, 2 long long, 3 size_t
+
+    *stars = 0;
+    while (*f && strchr("-+ #0", *f)) {
+        f++;
+    }
+    if (*f == '*') {
+        (*stars)++;
+        f++;
+    }
+    while (*f >= '0' && *f <= '9') {
+        f++;
+    }
+    if (*f == '.') {
+        f++;
+        if (*f == '*') {
+            (*stars)++;
+            f++;
+        }
+        while (*f >= '0' && *f <= '9') {
+            f++;
+        }
+    }
+    if (f[0] == 'l' && f[1] == 'l') {
+        length = 2, f += 2;
+    } else if (f[0] == 'I' && f[1] == '6' && f[2] == '4') {
+        length = 2, f += 3;
+    } else if (f[0] == 'I' && f[1] == '3' && f[2] == '2') {
+        f += 3;
+    } else if (*f == 'l') {
+        length = 1, f++;
+    } else if (*f == 'z' || *f == 'I') {
+        length = 3, f++;
+    } else {
+        while (*f == 'h') {
+            f++;
+        }
+    }
+    switch (*f) {
+    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+        *kind = length == 0 ? ARG_INT : length == 1 ? ARG_LONG : length == 2 ? ARG_LLONG : ARG_SIZE;
+        break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        *kind = ARG_DOUBLE;
+        break;
+    case 'p':
+        *kind = ARG_POINTER;
+        break;
+    case 's':
+        *kind = ARG_STRING;
+        break;
+    case '\0':
+        return NULL;
+    default:
+        *kind = ARG_NONE;  // "%%", and "%n" is never honored
+        break;
+    }
+    return f+1;
+}
+
+#define capture(type, value) \
+    if (p + sizeof(type) > end) { return count; } \
+    { type v = value; memcpy(p, &v, sizeof(type)); p += sizeof(type); }
+
+// Copies the arguments format consumes; returns how many conversions
+// fit in the record.
+static unsigned int captureArgs(const char *format, va_list args, unsigned char *p)
+{
+    unsigned char *end = p + ASYNC_LOG_ARG_BYTES;
+    unsigned int count = 0;
+    const char *f = format;
+    ArgKind kind;
+    int stars;
+
+    while ((f = strchr(f, '%')) != NULL) {
+        f = scanConversion(f+1, &kind, &stars);
+        if (!f) {
+            break;
+        }
+        while (stars-- > 0) {
+            capture(int, va_arg(args, int));
+        }
+        switch (kind) {
+        case ARG_NONE:
+            break;
+        case ARG_INT:
+            capture(int, va_arg(args, int));
+            break;
+        case ARG_LONG:
+            capture(long, va_arg(args, long));
+            break;
+        case ARG_LLONG:
+            capture(long long, va_arg(args, long long));
+            break;
+        case ARG_SIZE:
+            capture(size_t, va_arg(args, size_t));
+            break;
+        case ARG_DOUBLE:
+            capture(double, va_arg(args, double));
+            break;
+        case ARG_POINTER:
+            capture(void*, va_arg(args, void*));
+            break;
+        case ARG_STRING:
+            {
+                const char *s = va_arg(args, const char*);
+                size_t len;
+
+                if (!s) {
+                    s = "(null)";
+                }
+                len = strlen(s);
+                if (p + sizeof(unsigned short) + 1 > end) {
+                    return count;
+                }
+                if (len > (size_t)(end - p) - sizeof(unsigned short) - 1) {
+                    len = (end - p) - sizeof(unsigned short) - 1;  // truncate
+                }
+                capture(unsigned short, (unsigned short)len);
+                memcpy(p, s, len);
+                p[len] = '\0';
+                p += len + 1;
+            }
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+#undef capture
+
+#define fetch(type, var) \
+    memcpy(&var, p, sizeof(type)), p += sizeof(type)
+
+static void formatRecord(const AsyncLogRecord *rec)
+{
+    char line[1024];
+    const unsigned char *p = rec->arg;
+    const char *f = rec->format;
+    size_t len = 0;
+    unsigned int i;
+
+    for (i=0; i<rec->arg_count; i++) {
+        const char *percent = strchr(f, '%');
+        const char *next;
+        char spec[32];
+        ArgKind kind;
+        int stars, star[2] = { 0, 0 };
+        int rv = 0;
+
+        next = scanConversion(percent+1, &kind, &stars);
+        // Literal text before the conversion.
+        while (f < percent && len < sizeof(line)-1) {
+            line[len++] = *f++;
+        }
+        if (next - percent >= (int)sizeof(spec)) {
+            break;  // absurd conversion; give up on the rest
+        }
+        memcpy(spec, percent, next - percent);
+        spec[next - percent] = '\0';
+        f = next;
+        if (stars > 0) {
+            fetch(int, star[0]);
+        }
+        if (stars > 1) {
+            fetch(int, star[1]);
+        }
+
+#define emit(value) \
+        switch (stars) { \
+        case 0: rv = snprintf(line+len, sizeof(line)-len, spec, value); break; \
+        case 1: rv = snprintf(line+len, sizeof(line)-len, spec, star[0], value); break; \
+        default: rv = snprintf(line+len, sizeof(line)-len, spec, star[0], star[1], value); break; \
+        }
+
+        switch (kind) {
+        case ARG_NONE:
+            if (spec[1] == '%' && len < sizeof(line)-1) {
+                line[len++] = '%';
+            }
+            break;
+        case ARG_INT:
+            { int v; fetch(int, v); emit(v); }
+            break;
+        case ARG_LONG:
+            { long v; fetch(long, v); emit(v); }
+            break;
+        case ARG_LLONG:
+            { long long v; fetch(long long, v); emit(v); }
+            break;
+        case ARG_SIZE:
+            { size_t v; fetch(size_t, v); emit(v); }
+            break;
+        case ARG_DOUBLE:
+            { double v; fetch(double, v); emit(v); }
+            break;
+        case ARG_POINTER:
+            { void *v; fetch(void*, v); emit(v); }
+            break;
+        case ARG_STRING:
+            {
+                unsigned short n;
+                fetch(unsigned short, n);
+                emit((const char*)p);
+                p += n + 1;
+            }
+            break;
+        }
+#undef emit
+        // _snprintf returns -1 and does not terminate when truncating.
+        if (rv < 0 || (size_t)rv >= sizeof(line)-len) {
+            len = sizeof(line)-1;
+        } else {
+            len += rv;
+        }
+    }
+    // Literal tail; conversions past the captured arguments print as is.
+    while (*f && len < sizeof(line)-1) {
+        line[len++] = *f++;
+    }
+    line[len++] = '\n';
+    fputs(rec->prefix, out);
+    fwrite(line, 1, len, out);
+}
+#undef fetch
+
+// Formats every completed record; returns how many.
+static int drain(void)
+{
+    int count = 0;
+
+    for (;;) {
+        AsyncLogRecord *rec = &ring[tail & (ASYNC_LOG_RECORDS-1)];
+
+        if (rec->sequence != tail + 1) {
+            break;
+        }
+        barrier();
+        formatRecord(rec);
+        barrier();
+        rec->sequence = tail + ASYNC_LOG_RECORDS;  // free for the next lap
+        tail++;
+        count++;
+    }
+    if (count) {
+        fflush(out);
+    }
+    return count;
+}
+
+static void idle(void)
+{
+#ifdef _WIN32
+    Sleep(1);
+#else
+    struct timespec ms = { 0, 1000000 };
+    nanosleep(&ms, NULL);
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI drainThread(LPVOID unused)
+#else
+static void *drainThread(void *unused)
+#endif
+{
+    unsigned int reported_drops = 0;
+
+    (void)unused;
+    for (;;) {
+        const int done = stopping;
+
+        if (!drain()) {
+            if (done) {
+                break;
+            }
+            idle();
+        }
+        if (dropped != reported_drops) {
+            fprintf(out, "asynclog: %u messages dropped, ring full\n", dropped - reported_drops);
+            reported_drops = dropped;
+        }
+    }
+    return 0;
+}
+
+void startAsyncLog(FILE *file)
+{
+    unsigned int i;
+
+    if (running) {
+        return;
+    }
+    out = file;
+    for (i=0; i<ASYNC_LOG_RECORDS; i++) {
+        ring[i].sequence = i;
+    }
+    head = 0;
+    tail = 0;
+    stopping = 0;
+#ifdef _WIN32
+    thread = CreateThread(NULL, 0, drainThread, NULL, 0, NULL);
+    if (!thread) {
+        return;  // stay synchronous
+    }
+#else
+    if (pthread_create(&thread, NULL, drainThread, NULL)) {
+        return;  // stay synchronous
+    }
+#endif
+    running = 1;
+    atexit(stopAsyncLog);
+}
+
+void stopAsyncLog(void)
+{
+    if (!running) {
+        return;
+    }
+    stopping = 1;
+#ifdef _WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+    running = 0;
+}
+
+void vasyncLog(const char *prefix, const char *format, va_list args)
+{
+    AsyncLogRecord *rec;
+    unsigned int pos;
+
+    if (!running) {
+        // Before startAsyncLog (or after stopAsyncLog) write directly.
+        fputs(prefix, stdout);
+        vprintf(format, args);
+        fputc('\n', stdout);
+        fflush(stdout);
+        return;
+    }
+    for (;;) {
+        int lap;
+
+        pos = head;
+        rec = &ring[pos & (ASYNC_LOG_RECORDS-1)];
+        lap = (int)(rec->sequence - pos);
+        if (lap == 0) {
+            if (compareAndSwap(&head, pos, pos+1)) {
+                break;
+            }
+        } else if (lap < 0) {
+            // Drain thread is a full ring behind; never block the caller.
+            atomicIncrement(&dropped);
+            return;
+        }
+        // Otherwise another thread claimed pos first; try again.
+    }
+    rec->prefix = prefix;
+    rec->format = format;
+    rec->arg_count = captureArgs(format, args, rec->arg);
+    barrier();
+    rec->sequence = pos + 1;
+}
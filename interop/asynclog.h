@@ -0,0 +1,34 @@
+#ifndef ASYNCLOG_H
+#define ASYNCLOG_H
+
+/* asynclog.h - deferred-formatting logger drained by a background thread */
+
+/* vasyncLog copies the format string's address and the raw argument
+   values into a ring slot and returns; a background thread does the
+   printf formatting and the writes.  The format must be a string
+   literal (or otherwise outlive the message); %s arguments are copied.
+   When the ring is full, messages are dropped and counted rather than
+   stalling the caller. */
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ASYNC_LOG_RECORDS 4096       // must be a power of two
+#define ASYNC_LOG_ARG_BYTES 224      // raw arguments per message
+
+extern void startAsyncLog(FILE *out);
+/* Formats everything queued so far, then stops the thread.  Also
+   registered with atexit by startAsyncLog. */
+extern void stopAsyncLog(void);
+/* prefix, like format, must outlive the message. */
+extern void vasyncLog(const char *prefix, const char *format, va_list args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASYNCLOG_H */
@@ -0,0 +1,319 @@
+
+/* hud.c - OpenGL heads-up display of multiple live metrics */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+#include <assert.h>
+
+#include <GL/glew.h>
+
+#if __APPLE__
+#include <GLUT/glut.h>
+#else
+#include <GL/glut.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include "hud.h"
+
+#ifdef _WIN32
+#define snprintf _snprintf
+#endif
+
+// Glyph atlas holds printable ASCII rendered with GLUT_BITMAP_9_BY_15.
+#define first_glyph ' '
+#define last_glyph '~'
+#define glyph_width 9
+#define glyph_height 16
+#define atlas_width 1024
+static const float advance = glyph_width/(float)atlas_width;
+
+typedef struct {
+    GLfloat s, t;
+    GLfloat x, y;
+    GLubyte color[4];
+} HUDvertex;
+
+#define VERTICES_PER_METRIC (4*HUD_METRIC_CHARS)
+
+static GLuint makeGlyphAtlas(void)
+{
+    GLint old_fbo;
+    GLuint fbo, tex;
+    int c;
+
+    glGenTextures(1, &tex);
+    assert(tex);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, atlas_width, glyph_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // Rasterize the glyphs once into the texture, the same way
+    // fps_text_image.h was generated: a dark outline from the glyph
+    // drawn at its eight neighboring offsets, then the glyph in white.
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &old_fbo);
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+    assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+    glPushAttrib(GL_COLOR_BUFFER_BIT | GL_VIEWPORT_BIT | GL_CURRENT_BIT); {
+        int i, j;
+
+        glViewport(0, 0, atlas_width, glyph_height);
+        glClearColor(0, 0, 0, 0);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glColor4f(0, 0, 0.1f, 1);
+        for (i=-1; i<=1; i++) {
+            for (j=-1; j<=1; j++) {
+                if (i == 0 && j == 0) {
+                    continue;
+                }
+                for (c = first_glyph; c <= last_glyph; c++) {
+                    glWindowPos2i((c-first_glyph)*glyph_width + i, 4 + j);
+                    glutBitmapCharacter(GLUT_BITMAP_9_BY_15, c);
+                }
+            }
+        }
+        glColor4f(1, 1, 1, 1);
+        for (c = first_glyph; c <= last_glyph; c++) {
+            glWindowPos2i((c-first_glyph)*glyph_width, 4);
+            glutBitmapCharacter(GLUT_BITMAP_9_BY_15, c);
+        }
+    } glPopAttrib();
+    glBindFramebuffer(GL_FRAMEBUFFER, old_fbo);
+    glDeleteFramebuffers(1, &fbo);
+    return tex;
+}
+
+void initHUDcontext(HUDcontext *ctx, FPSorigin origin)
+{
+    ctx->width = 0;
+    ctx->height = 0;
+    ctx->scale = 1.0f;
+    ctx->origin = origin;
+    ctx->metric_count = 0;
+    ctx->glyph_texture = makeGlyphAtlas();
+
+    // Sized for every metric up front so updates are only ever
+    // glBufferSubData of the runs that changed.
+    glGenBuffers(1, &ctx->vertex_buffer);
+    assert(ctx->vertex_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, ctx->vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, MAX_HUD_METRICS*VERTICES_PER_METRIC*sizeof(HUDvertex), NULL, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static void invalidateHUD(HUDcontext *ctx)
+{
+    int i;
+
+    for (i=0; i<ctx->metric_count; i++) {
+        ctx->metric[i].dirty = 1;
+    }
+}
+
+void reshapeHUDcontext(HUDcontext *ctx, int w, int h)
+{
+    ctx->width = w;
+    ctx->height = h;
+    invalidateHUD(ctx);
+}
+
+void releaseHUDcontext(HUDcontext *ctx)
+{
+    if (ctx->glyph_texture) {
+        glDeleteTextures(1, &ctx->glyph_texture);
+        ctx->glyph_texture = 0;
+    }
+    if (ctx->vertex_buffer) {
+        glDeleteBuffers(1, &ctx->vertex_buffer);
+        ctx->vertex_buffer = 0;
+    }
+}
+
+int addHUDmetric(HUDcontext *ctx, const char *label, const char *format,
+                 float r, float g, float b)
+{
+    HUDmetric *m;
+
+    if (ctx->metric_count >= MAX_HUD_METRICS) {
+        return -1;
+    }
+    m = &ctx->metric[ctx->metric_count];
+    strncpy(m->label, label, sizeof(m->label)-1);
+    m->label[sizeof(m->label)-1] = '\0';
+    strncpy(m->format, format, sizeof(m->format)-1);
+    m->format[sizeof(m->format)-1] = '\0';
+    strcpy(m->text, m->label);
+    strcat(m->text, " --");
+    m->value = -666;  // bogus
+    m->color[0] = (GLubyte)(r*255 + 0.5f);
+    m->color[1] = (GLubyte)(g*255 + 0.5f);
+    m->color[2] = (GLubyte)(b*255 + 0.5f);
+    m->color[3] = 255;
+    m->dirty = 1;
+    return ctx->metric_count++;
+}
+
+void setHUDmetric(HUDcontext *ctx, int metric, double value)
+{
+    HUDmetric *m;
+    char text[HUD_METRIC_CHARS+1];
+    size_t label_len;
+
+    assert(metric >= 0 && metric < ctx->metric_count);
+    m = &ctx->metric[metric];
+    if (value == m->value) {
+        return;
+    }
+    m->value = value;
+    // Values often change without changing their displayed digits.
+    label_len = strlen(m->label);
+    memcpy(text, m->label, label_len);
+    text[label_len] = ' ';
+    snprintf(text+label_len+1, sizeof(text)-label_len-1, m->format, value);
+    text[HUD_METRIC_CHARS] = '\0';
+    if (strcmp(text, m->text)) {
+        strcpy(m->text, text);
+        m->dirty = 1;
+    }
+}
+
+void scaleHUD(HUDcontext *ctx, float new_scale)
+{
+    if (new_scale != ctx->scale) {
+        ctx->scale = new_scale;
+        invalidateHUD(ctx);
+    }
+}
+
+static void computeRowLocation(HUDcontext *ctx, int row, float *x, float *y)
+{
+    const int w = ctx->width, h = ctx->height;
+    const float scale = ctx->scale;
+    const float right = w-15-HUD_METRIC_CHARS*glyph_width*scale;
+
+    switch (ctx->origin) {
+    case FPS_LOWER_RIGHT:
+        *x = right;
+        *y = 15+row*glyph_height*scale;
+        break;
+    case FPS_LOWER_LEFT:
+        *x = 15;
+        *y = 15+row*glyph_height*scale;
+        break;
+    case FPS_UPPER_RIGHT:
+        *x = right;
+        *y = h-15-(row+1)*glyph_height*scale;
+        break;
+    default:
+        assert(!"bogus origin");
+        // Fallthrough...
+    case FPS_UPPER_LEFT:
+        *x = 15;
+        *y = h-15-(row+1)*glyph_height*scale;
+        break;
+    }
+}
+
+static void buildMetricVertices(HUDcontext *ctx, int row, HUDvertex *v)
+{
+    const HUDmetric *m = &ctx->metric[row];
+    const float scale = ctx->scale;
+    const char *c = m->text;
+    float x, y;
+    int i;
+
+#define vertex(S,T,X,Y) \
+    v->s = S, v->t = T, v->x = X, v->y = Y, memcpy(v->color, m->color, 4), v++
+
+    computeRowLocation(ctx, row, &x, &y);
+    for (i=0; i<HUD_METRIC_CHARS; i++) {
+        if (*c) {
+            const int in_atlas = *c >= first_glyph && *c <= last_glyph;
+            const float s = (in_atlas ? *c-first_glyph : '?'-first_glyph)*advance;
+
+            vertex(s, 0, x, y);
+            vertex(s+advance, 0, x+glyph_width*scale, y);
+            vertex(s+advance, 1, x+glyph_width*scale, y+glyph_height*scale);
+            vertex(s, 1, x, y+glyph_height*scale);
+            c++;
+        } else {
+            // Unused tail of the run collapses to degenerate quads.
+            vertex(0, 0, x, y);
+            vertex(0, 0, x, y);
+            vertex(0, 0, x, y);
+            vertex(0, 0, x, y);
+        }
+        x += glyph_width*scale;
+    }
+#undef vertex
+}
+
+void drawHUD(HUDcontext *ctx)
+{
+    int i;
+
+    if (ctx->metric_count == 0) {
+        return;
+    }
+
+    assert(!glIsEnabled(GL_DEPTH_TEST));
+    assert(!glIsEnabled(GL_TEXTURE_2D));
+
+    glBindBuffer(GL_ARRAY_BUFFER, ctx->vertex_buffer);
+    for (i=0; i<ctx->metric_count; i++) {
+        if (ctx->metric[i].dirty) {
+            HUDvertex run[VERTICES_PER_METRIC];
+
+            buildMetricVertices(ctx, i, run);
+            glBufferSubData(GL_ARRAY_BUFFER, i*sizeof(run), sizeof(run), run);
+            ctx->metric[i].dirty = 0;
+        }
+    }
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix(); {
+        glLoadIdentity();
+        glMatrixMode(GL_PROJECTION);
+        glPushMatrix(); {
+            const int w = ctx->width, h = ctx->height;
+
+            assert(w > 0);
+            assert(h > 0);
+            glLoadIdentity();
+            glOrtho(0, w, 0, h, -1, 1);
+
+            glActiveTexture(GL_TEXTURE0);
+            glEnable(GL_TEXTURE_2D);
+            glBindTexture(GL_TEXTURE_2D, ctx->glyph_texture);
+            glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+            glDisable(GL_BLEND);
+            glDisable(GL_STENCIL_TEST);
+            glEnable(GL_ALPHA_TEST);
+            glAlphaFunc(GL_GREATER, 0);
+
+            glClientActiveTexture(GL_TEXTURE0);
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+            glEnableClientState(GL_COLOR_ARRAY);
+            glTexCoordPointer(2, GL_FLOAT, sizeof(HUDvertex), (const GLvoid*)0);
+            glVertexPointer(2, GL_FLOAT, sizeof(HUDvertex), (const GLvoid*)(2*sizeof(GLfloat)));
+            glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(HUDvertex), (const GLvoid*)(4*sizeof(GLfloat)));
+            // Every metric in one draw.
+            glDrawArrays(GL_QUADS, 0, ctx->metric_count*VERTICES_PER_METRIC);
+            glDisableClientState(GL_COLOR_ARRAY);
+            glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+            assert(glGetError() == GL_NO_ERROR);
+
+            glDisable(GL_TEXTURE_2D);
+            glDisable(GL_ALPHA_TEST);
+        } glPopMatrix();
+        glMatrixMode(GL_MODELVIEW);
+    } glPopMatrix();
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
@@ -0,0 +1,53 @@
+#ifndef HUD_H
+#define HUD_H
+
+/* hud.h - OpenGL heads-up display of multiple live metrics */
+
+/* Each metric owns a fixed run of glyph quads in one streamed vertex
+   buffer; setting a metric rewrites its run only when the displayed
+   text changes, and drawHUD renders every metric with a single draw. */
+
+#include "showfps.h"  // for FPSorigin
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAX_HUD_METRICS 16
+#define HUD_METRIC_CHARS 24  // label, space, and formatted value
+
+typedef struct _HUDmetric {
+    char label[8];
+    char format[16];
+    char text[HUD_METRIC_CHARS+1];  // text last written to the vertex buffer
+    double value;
+    GLubyte color[4];
+    int dirty;
+} HUDmetric;
+
+typedef struct _HUDcontext {
+    int width, height;
+    float scale;
+    FPSorigin origin;
+    GLuint glyph_texture;
+    GLuint vertex_buffer;
+    int metric_count;
+    HUDmetric metric[MAX_HUD_METRICS];
+} HUDcontext;
+
+extern void initHUDcontext(HUDcontext *ctx, FPSorigin origin);
+extern void reshapeHUDcontext(HUDcontext *ctx, int w, int h);
+extern void releaseHUDcontext(HUDcontext *ctx);
+
+/* Returns the metric's index for setHUDmetric, or -1 if full. */
+extern int addHUDmetric(HUDcontext *ctx, const char *label, const char *format,
+                        float r, float g, float b);
+extern void setHUDmetric(HUDcontext *ctx, int metric, double value);
+extern void scaleHUD(HUDcontext *ctx, float new_scale);
+extern void drawHUD(HUDcontext *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HUD_H */
@@ -0,0 +1,419 @@
+
+/* imageconvert.c - whole image sRGB, alpha, and channel order conversion */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>  /* for CreateThread, critical sections, and condition variables */
+#else
+#include <pthread.h>
+#include <unistd.h>   /* for sysconf */
+#endif
+
+#include "imageconvert.h"
+#include "sRGB_math.h"
+
+#define IMAGE_SPAN_PIXELS 512      // pixels per pass through the steps; 8 KB of floats
+#define IMAGE_BAND_PIXELS 65536    // pixels per band handed to a thread
+#define IMAGE_MAX_THREADS 64
+
+#ifdef _WIN32
+typedef CRITICAL_SECTION Mutex;
+typedef CONDITION_VARIABLE Condition;
+typedef HANDLE Thread;
+#define initMutex(m) InitializeCriticalSection(m)
+#define destroyMutex(m) DeleteCriticalSection(m)
+#define lockMutex(m) EnterCriticalSection(m)
+#define unlockMutex(m) LeaveCriticalSection(m)
+#define initCondition(c) InitializeConditionVariable(c)
+#define destroyCondition(c)
+#define waitCondition(c, m) SleepConditionVariableCS(c, m, INFINITE)
+#define wakeAll(c) WakeAllConditionVariable(c)
+#else
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Condition;
+typedef pthread_t Thread;
+#define initMutex(m) pthread_mutex_init(m, NULL)
+#define destroyMutex(m) pthread_mutex_destroy(m)
+#define lockMutex(m) pthread_mutex_lock(m)
+#define unlockMutex(m) pthread_mutex_unlock(m)
+#define initCondition(c) pthread_cond_init(c, NULL)
+#define destroyCondition(c) pthread_cond_destroy(c)
+#define waitCondition(c, m) pthread_cond_wait(c, m)
+#define wakeAll(c) pthread_cond_broadcast(c)
+#endif
+
+// The steps one conversion takes, decided once per image.
+typedef struct _ImageJob {
+    const ImageDesc *dst, *src;
+    size_t dst_stride, src_stride;
+    int unpremultiply;
+    int decode;
+    int encode;
+    int premultiply;
+    int swap;           // orders differ: exchange red and blue
+    int band_rows;
+    int bands;
+} ImageJob;
+
+struct _ImageConverter {
+    int threads;        // including whichever thread calls convertImage
+    int started;        // worker threads running
+    Mutex lock;
+    Condition wake;     // a job was posted, or stopping
+    Condition done;     // the last band of the job finished
+    unsigned int generation;
+    int stopping;
+    const ImageJob *job;
+    int next_band;
+    int finished_bands;
+    Thread thread[IMAGE_MAX_THREADS];
+};
+
+static size_t pixelBytes(ImageType type)
+{
+    return type == IMAGE_FLOAT ? 4*sizeof(float) : 4;
+}
+
+static void swapRedBlueub(unsigned char *p, int n)
+{
+    int i;
+
+    for (i=0; i<n; i++, p+=4) {
+        const unsigned char r = p[0];
+
+        p[0] = p[2];
+        p[2] = r;
+    }
+}
+
+// Converts n pixels with the job's steps.  Float results are staged in
+// dst itself, so the span is written once; byte results go through
+// buffer.
+static void convertSpan(const ImageJob *job, void *dst, const void *src, int n, float *buffer)
+{
+    const ImageType dst_type = job->dst->type;
+    const ImageType src_type = job->src->type;
+    // Where the source's red and blue land in the destination order.
+    const int r = job->swap ? 2 : 0;
+    const int b = 2 - r;
+    float *p = dst_type == IMAGE_FLOAT ? (float*)dst : buffer;
+    int i;
+
+    if (!job->unpremultiply && !job->decode && !job->encode && !job->premultiply &&
+        dst_type == src_type) {
+        if (dst != src) {
+            memmove(dst, src, n * pixelBytes(dst_type));
+        }
+        if (job->swap) {
+            if (dst_type == IMAGE_UNSIGNED_BYTE) {
+                swapRedBlueub((unsigned char*)dst, n);
+            } else {
+                for (i=0; i<n; i++, p+=4) {
+                    const float red = p[0];
+
+                    p[0] = p[2];
+                    p[2] = red;
+                }
+            }
+        }
+        return;
+    }
+
+    // Load as float in the destination's channel order, dividing out
+    // alpha on the way in; every later step treats red and blue alike.
+    if (src_type == IMAGE_UNSIGNED_BYTE) {
+        const unsigned char *s = (const unsigned char*)src;
+
+        if (job->unpremultiply) {
+            for (i=0; i<4*n; i+=4) {
+                // c/255 divided by a/255 is c/a.
+                const float scale = s[i+3] ? 1.0f/s[i+3] : 0.0f;
+                const float red = s[i+0] * scale;
+                const float blue = s[i+2] * scale;
+
+                p[i+r] = red;
+                p[i+1] = s[i+1] * scale;
+                p[i+b] = blue;
+                p[i+3] = s[i+3] * (1.0f/255.0f);
+            }
+        } else if (job->decode) {
+            convertSRGBubToLinearf(p, s, n);
+            if (job->swap) {
+                for (i=0; i<4*n; i+=4) {
+                    const float red = p[i+0];
+
+                    p[i+0] = p[i+2];
+                    p[i+2] = red;
+                }
+            }
+        } else {
+            for (i=0; i<4*n; i+=4) {
+                const float red = s[i+0] * (1.0f/255.0f);
+                const float blue = s[i+2] * (1.0f/255.0f);
+
+                p[i+r] = red;
+                p[i+1] = s[i+1] * (1.0f/255.0f);
+                p[i+b] = blue;
+                p[i+3] = s[i+3] * (1.0f/255.0f);
+            }
+        }
+    } else {
+        // May be in place, so read a whole pixel before writing it.
+        const float *s = (const float*)src;
+
+        for (i=0; i<4*n; i+=4) {
+            const float scale = !job->unpremultiply ? 1.0f : s[i+3] > 0.0f ? 1.0f/s[i+3] : 0.0f;
+            const float red = s[i+0] * scale;
+            const float green = s[i+1] * scale;
+            const float blue = s[i+2] * scale;
+            const float alpha = s[i+3];
+
+            p[i+r] = red;
+            p[i+1] = green;
+            p[i+b] = blue;
+            p[i+3] = alpha;
+        }
+    }
+
+    if (job->decode && (src_type == IMAGE_FLOAT || job->unpremultiply)) {
+        convertSRGBToLinearf(p, p, n);
+    }
+
+    if (job->encode) {
+        if (dst_type == IMAGE_UNSIGNED_BYTE && !job->premultiply) {
+            convertLinearToSRGBub((unsigned char*)dst, p, n);
+            return;
+        }
+        convertLinearToSRGBf(p, p, n);
+    }
+
+    if (job->premultiply) {
+        for (i=0; i<4*n; i+=4) {
+            p[i+0] *= p[i+3];
+            p[i+1] *= p[i+3];
+            p[i+2] *= p[i+3];
+        }
+    }
+
+    if (dst_type == IMAGE_UNSIGNED_BYTE) {
+        unsigned char *d = (unsigned char*)dst;
+
+        for (i=0; i<4*n; i++) {
+            // Compare and select rather than min/max so NaN becomes 0.
+            const float v = p[i] > 0.0f ? (p[i] < 1.0f ? p[i] : 1.0f) : 0.0f;
+
+            d[i] = (unsigned char)(v * 255.0f + 0.5f);
+        }
+    }
+}
+
+static void convertBand(const ImageJob *job, int band)
+{
+    const int first = band * job->band_rows;
+    const int last = first + job->band_rows < job->src->height ? first + job->band_rows : job->src->height;
+    const int width = job->src->width;
+    const size_t dst_pixel = pixelBytes(job->dst->type);
+    const size_t src_pixel = pixelBytes(job->src->type);
+    float buffer[4*IMAGE_SPAN_PIXELS];
+    int y, x;
+
+    for (y=first; y<last; y++) {
+        unsigned char *dst = (unsigned char*)job->dst->pixels + y * job->dst_stride;
+        const unsigned char *src = (const unsigned char*)job->src->pixels + y * job->src_stride;
+
+        for (x=0; x<width; x+=IMAGE_SPAN_PIXELS) {
+            const int n = width - x < IMAGE_SPAN_PIXELS ? width - x : IMAGE_SPAN_PIXELS;
+
+            convertSpan(job, dst + x*dst_pixel, src + x*src_pixel, n, buffer);
+        }
+    }
+}
+
+// Converts bands of the current job until none are left.
+static void runBands(ImageConverter *converter)
+{
+    for (;;) {
+        const ImageJob *job;
+        int band;
+
+        lockMutex(&converter->lock);
+        job = converter->job;
+        if (!job || converter->next_band >= job->bands) {
+            unlockMutex(&converter->lock);
+            return;
+        }
+        band = converter->next_band++;
+        unlockMutex(&converter->lock);
+
+        convertBand(job, band);
+
+        lockMutex(&converter->lock);
+        if (++converter->finished_bands == job->bands) {
+            wakeAll(&converter->done);
+        }
+        unlockMutex(&converter->lock);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI workerThread(LPVOID data)
+#else
+static void *workerThread(void *data)
+#endif
+{
+    ImageConverter *converter = (ImageConverter*)data;
+    unsigned int seen = 0;
+
+    for (;;) {
+        lockMutex(&converter->lock);
+        while (converter->generation == seen && !converter->stopping) {
+            waitCondition(&converter->wake, &converter->lock);
+        }
+        if (converter->stopping) {
+            unlockMutex(&converter->lock);
+            return 0;
+        }
+        seen = converter->generation;
+        unlockMutex(&converter->lock);
+        runBands(converter);
+    }
+}
+
+static int processorCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+ImageConverter *createImageConverter(int threads)
+{
+    ImageConverter *converter = (ImageConverter*)calloc(1, sizeof(ImageConverter));
+    int i;
+
+    if (!converter) {
+        return NULL;
+    }
+    if (threads <= 0) {
+        threads = processorCount();
+    }
+    if (threads > IMAGE_MAX_THREADS) {
+        threads = IMAGE_MAX_THREADS;
+    }
+    initMutex(&converter->lock);
+    initCondition(&converter->wake);
+    initCondition(&converter->done);
+    for (i=0; i<threads-1; i++) {
+#ifdef _WIN32
+        converter->thread[i] = CreateThread(NULL, 0, workerThread, converter, 0, NULL);
+        if (!converter->thread[i]) {
+            break;
+        }
+#else
+        if (pthread_create(&converter->thread[i], NULL, workerThread, converter)) {
+            break;
+        }
+#endif
+    }
+    converter->started = i;
+    converter->threads = i + 1;
+    return converter;
+}
+
+void destroyImageConverter(ImageConverter *converter)
+{
+    int i;
+
+    if (!converter) {
+        return;
+    }
+    lockMutex(&converter->lock);
+    converter->stopping = 1;
+    wakeAll(&converter->wake);
+    unlockMutex(&converter->lock);
+    for (i=0; i<converter->started; i++) {
+#ifdef _WIN32
+        WaitForSingleObject(converter->thread[i], INFINITE);
+        CloseHandle(converter->thread[i]);
+#else
+        pthread_join(converter->thread[i], NULL);
+#endif
+    }
+    destroyCondition(&converter->done);
+    destroyCondition(&converter->wake);
+    destroyMutex(&converter->lock);
+    free(converter);
+}
+
+int imageConverterThreads(const ImageConverter *converter)
+{
+    return converter ? converter->threads : 1;
+}
+
+int convertImage(ImageConverter *converter, const ImageDesc *dst, const ImageDesc *src)
+{
+    const int src_srgb = (src->flags & IMAGE_SRGB) != 0;
+    const int dst_srgb = (dst->flags & IMAGE_SRGB) != 0;
+    const int src_premultiplied = (src->flags & IMAGE_PREMULTIPLIED) != 0;
+    const int dst_premultiplied = (dst->flags & IMAGE_PREMULTIPLIED) != 0;
+    ImageJob job;
+    int band;
+
+    if (dst->width != src->width || dst->height != src->height) {
+        return 0;
+    }
+    if (src->width <= 0 || src->height <= 0) {
+        return 1;
+    }
+    job.dst = dst;
+    job.src = src;
+    job.dst_stride = dst->stride ? dst->stride : dst->width * pixelBytes(dst->type);
+    job.src_stride = src->stride ? src->stride : src->width * pixelBytes(src->type);
+    job.decode = src_srgb && !dst_srgb;
+    job.encode = dst_srgb && !src_srgb;
+    // Alpha comes out and goes back in around a change of encoding.
+    job.unpremultiply = src_premultiplied && (!dst_premultiplied || job.decode || job.encode);
+    job.premultiply = dst_premultiplied && (!src_premultiplied || job.decode || job.encode);
+    job.swap = dst->order != src->order;
+    job.band_rows = IMAGE_BAND_PIXELS / src->width;
+    if (job.band_rows < 1) {
+        job.band_rows = 1;
+    }
+    job.bands = (src->height + job.band_rows - 1) / job.band_rows;
+
+    if (!converter || converter->threads == 1 || job.bands == 1) {
+        for (band=0; band<job.bands; band++) {
+            convertBand(&job, band);
+        }
+        return 1;
+    }
+
+    lockMutex(&converter->lock);
+    converter->job = &job;
+    converter->next_band = 0;
+    converter->finished_bands = 0;
+    converter->generation++;
+    wakeAll(&converter->wake);
+    unlockMutex(&converter->lock);
+
+    runBands(converter);
+
+    lockMutex(&converter->lock);
+    while (converter->finished_bands < job.bands) {
+        waitCondition(&converter->done, &converter->lock);
+    }
+    converter->job = NULL;
+    unlockMutex(&converter->lock);
+    return 1;
+}
@@ -0,0 +1,65 @@
+#ifndef IMAGECONVERT_H
+#define IMAGECONVERT_H
+
+/* imageconvert.h - whole image sRGB, alpha, and channel order conversion */
+
+/* convertImage converts RGBA or BGRA images, unsigned byte or float,
+   between linear and sRGB encodings, straight and premultiplied alpha,
+   and channel orders in a single pass.  Each span of pixels goes
+   through every step while it sits in cache (in the destination
+   itself for float images, else a small per thread buffer), so the
+   image is read once and written once however many steps there are.
+   Bands of rows run on the converter's thread pool.
+
+   Premultiplied means the stored color components (in whatever
+   encoding they have) are multiplied by alpha; converting between
+   encodings of premultiplied images divides alpha out first and
+   multiplies it back after. */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    IMAGE_UNSIGNED_BYTE,
+    IMAGE_FLOAT
+} ImageType;
+
+typedef enum {
+    IMAGE_RGBA,
+    IMAGE_BGRA
+} ImageOrder;
+
+#define IMAGE_SRGB          0x1   // color components are sRGB encoded
+#define IMAGE_PREMULTIPLIED 0x2   // color components are multiplied by alpha
+
+typedef struct _ImageDesc {
+    void *pixels;
+    int width, height;
+    size_t stride;                // bytes from one row to the next; 0 if packed
+    ImageType type;
+    ImageOrder order;
+    unsigned int flags;           // IMAGE_SRGB, IMAGE_PREMULTIPLIED
+} ImageDesc;
+
+typedef struct _ImageConverter ImageConverter;
+
+/* threads counts the calling thread, which works too; 0 means one per
+   processor.  Returns NULL if no thread could be started. */
+extern ImageConverter *createImageConverter(int threads);
+extern void destroyImageConverter(ImageConverter *converter);
+extern int imageConverterThreads(const ImageConverter *converter);
+
+/* Returns nonzero on success, zero if the sizes differ.  dst may be
+   src itself when both have the same type and stride.  A NULL
+   converter converts on the calling thread alone.  One image at a
+   time per converter. */
+extern int convertImage(ImageConverter *converter, const ImageDesc *dst, const ImageDesc *src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMAGECONVERT_H */
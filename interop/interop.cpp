@@ -28,6 +28,11 @@
 #include <wrl/client.h>  // for Microsoft::WRL::ComPtr template
 
 #include "showfps.h"        // show frames per second performance
+#include "slotsync.h"       // timed lock/unlock of the shared textures
+#include "trace.h"          // cross-process trace events
+#include "pipestats.h"      // pipeline counters read by interopstat
+#include "asynclog.h"       // logf/reportf formatting off the calling thread
+#include "hud.h"            // heads-up display of pipeline metrics
 #include "request_vsync.h"  // control vertical refresh synchronization for buffer swaps
 #include "sRGB_math.h"
 
@@ -45,6 +50,9 @@ bool mipmap_sharetex = 1;   // -bitmap_text sets false
 bool use_nvpr = 1;          // -bitmap sets false
 UINT32 object_to_draw = 0;
 bool timer_updates_renderer_window = true;
+const char *trace_filename = NULL;  // -trace names file written at exit
+int idle_policy = GLUT_IDLE_REFRESH;  // -idle continuous/refresh/events/microseconds
+GLUTnanoseconds idle_interval = 0;
 
 // Initially the master; spawning renderer reverses these.
 bool i_am_master = true;
@@ -63,6 +71,9 @@ HANDLE wgl_d3d_device;
 HANDLE job;
 
 FPScontext fps_ctx;  // context for reporting frames/second performance
+HUDcontext hud_ctx;  // master's heads-up display of pipeline metrics
+bool show_hud = false;  // 'h' toggles
+int hud_fps, hud_ring_depth, hud_dropped, hud_p99, hud_latency, hud_late;
 
 // Helper macros
 #define arraysize(a) (sizeof(a) / sizeof((a)[0]))
@@ -77,9 +88,14 @@ struct SharedTexture {
 
 // Master-only state
 UINT32 current_sharetex_index = -1;
+UINT32 frames_skipped = 0;
+FPSring master_frames;  // intervals between frames the master displays
+FPSgraph frame_graph;
+bool show_graph = false;  // 'g' toggles
 
 // Renderrer only state
 GLuint stencil_tex;
+FPScounter produce_counter;  // paces frames produced for the master
 
 static void fatalError(const char *message)
 {
@@ -95,6 +111,8 @@ int render_buffer_count = 4;
 SharedTexture sharetex[MAX_RENDER_BUFFER];
 
 struct SharedData {
+    PipelineStats stats;  // must stay first so interopstat can map just this
+
     int render_interval;
     bool use_nvpr;
     UINT32 object_to_draw;
@@ -115,13 +133,33 @@ struct SharedData {
 
     bool renderer_should_terminate;
     bool master_should_terminate;
+
+    FPSring renderer_frames;  // intervals between frames the renderer produces
+
+    TraceRing master_trace;
+    TraceRing renderer_trace;
+
+    SlotSyncStats slot_sync[MAX_RENDER_BUFFER];
 };
 
 SharedData* sharedData;
 
-int logf(const char *fmt, ...)
+static_assert(MAX_RENDER_BUFFER <= PIPELINE_MAX_BUFFERS, "publish_us too small");
+
+// Index of this process's counters in sharedData->stats.
+static int statsProcess()
+{
+    return i_am_master ? PIPELINE_MASTER : PIPELINE_RENDERER;
+}
+
+// Microseconds of the system-wide clock, truncated as pipestats.h describes.
+static unsigned int statsMicroseconds()
+{
+    return (unsigned int)(traceClock() / 1000);
+}
+
+void logf(const char *fmt, ...)
 {
-    int rv = 0;
     va_list args;
     va_start(args, fmt);
     bool print_message = logging;
@@ -130,32 +168,27 @@ int logf(const char *fmt, ...)
     }
     if (print_message) {
         const char *whoami = i_am_master ? "MASTER: " : "RENDERER: ";
-        fwrite(whoami, strlen(whoami), sizeof(char), stdout);
-        rv = vprintf(fmt, args);
-        fputc('\n', stdout);
-        fflush(stdout);
+        // Formatting and writing happen on the log thread.
+        vasyncLog(whoami, fmt, args);
     }
     va_end(args);
-    return rv;
 }
 
-int reportf(const char *fmt, ...)
+void reportf(const char *fmt, ...)
 {
-    int rv = 0;
     va_list args;
     va_start(args, fmt);
     const char *whoami = i_am_master ? "MASTER: " : "RENDERER: ";
-    fwrite(whoami, strlen(whoami), sizeof(char), stdout);
-    rv = vprintf(fmt, args);
-    fputc('\n', stdout);
-    fflush(stdout);
+    vasyncLog(whoami, fmt, args);
     va_end(args);
-    return rv;
 }
 
 void reshape(int w, int h)
 {
     reshapeFPScontext(&fps_ctx, w, h);
+    if (i_am_master) {
+        reshapeHUDcontext(&hud_ctx, w, h);
+    }
     window_width = w;
     window_height = h;
     glViewport(0, 0, w, h);
@@ -335,17 +368,29 @@ void formatMessage(DWORD dw)
 // Run by the master to spawn the renderer.
 void spawnRendererProcess(const char *program)
 {
-    // Create nameless memory mapping of sharedData for sharing data with renderer process.
+    // Create memory mapping of sharedData for sharing data with renderer process.
+    // The renderer inherits the handle; the name only lets interopstat attach.
     SECURITY_ATTRIBUTES attributes;
     attributes.bInheritHandle = true;
     attributes.lpSecurityDescriptor = NULL;
     attributes.nLength = 0;
-    const HANDLE map_file_handle = CreateFileMapping(INVALID_HANDLE_VALUE, &attributes, PAGE_READWRITE, 0, sizeof(SharedData), /*nameless*/NULL);
+    char mapping_name[64];
+    sprintf(mapping_name, PIPELINE_STATS_MAPPING, GetCurrentProcessId());
+    const HANDLE map_file_handle = CreateFileMappingA(INVALID_HANDLE_VALUE, &attributes, PAGE_READWRITE, 0, sizeof(SharedData), mapping_name);
     logf("map_file_handle=%p", map_file_handle);
     sharedData = (SharedData*)MapViewOfFile(map_file_handle, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedData));
     logf("sharedData=0x%p", sharedData);
+    initTraceRing(&sharedData->master_trace, "master", GetCurrentProcessId());
+    trace_ring = &sharedData->master_trace;
 
     ZeroMemory(sharedData, sizeof(sharedData));
+    sharedData->stats.magic = PIPELINE_STATS_MAGIC;
+    sharedData->stats.version = PIPELINE_STATS_VERSION;
+    sharedData->stats.size = sizeof(PipelineStats);
+    sharedData->stats.pid[PIPELINE_MASTER] = GetCurrentProcessId();
+    sharedData->stats.render_buffer_count = render_buffer_count;
+    initSlotSync(&slot_sync, &dx_interop_sync, NULL, SLOT_SYNC_MASTER,
+        sharedData->slot_sync, MAX_RENDER_BUFFER, /*reset*/1);
     sharedData->render_interval = 1000;
     sharedData->use_nvpr = use_nvpr;
     sharedData->object_to_draw = object_to_draw;
@@ -598,10 +643,10 @@ void renderScene()
 
     setClearColor(1, 0, 0, 1);
 
-    int time = glutGet(GLUT_ELAPSED_TIME);
+    const double seconds = glutGetNanoseconds() / 1e9;
     glWindowPos2f(40, 50);
     char buffer[200];
-    sprintf(buffer, "Drawn in renderer after %0.2f seconds", time/1000.f);
+    sprintf(buffer, "Drawn in renderer after %0.2f seconds", seconds);
     drawString(buffer);
 }
 
@@ -612,12 +657,15 @@ void displayRenderer()
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT|GL_STENCIL_BUFFER_BIT);
     glViewport(0, 0, window_width, window_height);
     renderScene();
+    TRACE_BEGIN(TRACE_SWAP);
     glutSwapBuffers();
+    TRACE_END(TRACE_SWAP);
 }
 
 void handleFailedLock()
 {
     DWORD err = GetLastError();
+    PIPELINE_COUNT(&sharedData->stats, lock_failures[statsProcess()]);
     formatMessage(err);
     switch (HRESULT_CODE(err)) {
     case ERROR_BUSY:
@@ -638,6 +686,7 @@ void handleFailedLock()
 void handleFailedUnlock()
 {
     DWORD err = GetLastError();
+    PIPELINE_COUNT(&sharedData->stats, unlock_failures[statsProcess()]);
     formatMessage(err);
     switch (HRESULT_CODE(err)) {
     case ERROR_BUSY:
@@ -655,22 +704,48 @@ void handleFailedUnlock()
     }
 }
 
-bool renderLockedSharedTexture(SharedTexture& tex, void(*renderFunc)(SharedTexture& tex))
+// SlotSync backend for WGL_NV_DX_interop2; errors are reported here,
+// while GetLastError still holds them.
+static int lockDXInterop(void *data, int slot)
+{
+    if (!wglDXLockObjectsNV(wgl_d3d_device, 1, &sharetex[slot].sharetex_wgl_lock_handle)) {
+        handleFailedLock();
+        return 0;
+    }
+    return 1;
+}
+
+static int unlockDXInterop(void *data, int slot)
 {
-    BOOL lock_ok = wglDXLockObjectsNV(wgl_d3d_device, 1, &tex.sharetex_wgl_lock_handle);
-    if (lock_ok) {
-        renderFunc(tex);
+    if (!wglDXUnlockObjectsNV(wgl_d3d_device, 1, &sharetex[slot].sharetex_wgl_lock_handle)) {
+        handleFailedUnlock();
+        return 0;
+    }
+    return 1;
+}
+
+static const SlotSyncBackend dx_interop_sync = {
+    "WGL_NV_DX_interop2",
+    lockDXInterop,
+    unlockDXInterop
+};
+
+SlotSync slot_sync;
 
-        BOOL unlock_ok = wglDXUnlockObjectsNV(wgl_d3d_device, 1, &tex.sharetex_wgl_lock_handle);
-        if (unlock_ok) {
+bool renderLockedSharedTexture(int slot, void(*renderFunc)(SharedTexture& tex))
+{
+    if (lockSlot(&slot_sync, slot)) {
+        TRACE_BEGIN(TRACE_DRAW);
+        renderFunc(sharetex[slot]);
+        TRACE_END(TRACE_DRAW);
+
+        if (unlockSlot(&slot_sync, slot)) {
             logf("successful lock/render/unlock");
             return true;
         } else {
-            handleFailedUnlock();
             return false;
         }
     } else {
-        handleFailedLock();
         return false;
     }
 }
@@ -685,12 +760,13 @@ void grabAllLocks()
 
 void renderSharedTexture(SharedTexture& tex)
 {
-    const int time = glutGet(GLUT_ELAPSED_TIME);
-    const int mask255 = 0x3ff;
-    const int timeMod255 = time & mask255;
-    const float percent = timeMod255 / float(mask255 + 1);
+    // Full nanosecond resolution keeps the oscillation smooth at
+    // frame rates well past what millisecond time could resolve.
+    const GLUTnanoseconds time = glutGetNanoseconds();
+    const GLUTnanoseconds period = 1024*1000000;  // 1.024 seconds
+    const float percent = float(time % period) / float(period);
     const float radians = percent*3.14159 * 2;
-    logf("time = %d ms, x = %g, sin = %g", time, percent, sin(radians));
+    logf("time = %0.3f ms, x = %g, sin = %g", time/1e6, percent, sin(radians));
 
     // Oscillate rotation of -10 to 10 degrees.
     glMatrixLoadIdentityEXT(GL_MODELVIEW);
@@ -717,6 +793,11 @@ void renderSharedTexture(SharedTexture& tex)
     glMatrixLoadIdentityEXT(GL_MODELVIEW);
 }
 
+// consumeCount of the frame last counted in sharedData->stats.consumed
+static UINT32 last_consumed = ~0u;
+// Its microseconds from the renderer publishing it to first display
+static unsigned int last_latency_us = 0;
+
 void displayMaster()
 {
     assert(i_am_master);
@@ -737,23 +818,59 @@ void displayMaster()
     UINT32 ndx = sharedData->consumeCount % render_buffer_count;
     logf("produce to index %d", ndx);
 
+    // The newest frame stays on screen until a newer one replaces it;
+    // count it, and its latency, only the first time.
+    if (sharedData->consumeCount != last_consumed) {
+        PipelineStats *stats = &sharedData->stats;
+        const unsigned int latency = statsMicroseconds() - stats->publish_us[ndx];
+
+        last_consumed = sharedData->consumeCount;
+        last_latency_us = latency;
+        stats->latency_us[stats->latency_count & (PIPELINE_LATENCY_SAMPLES-1)] = latency;
+        PIPELINE_COUNT(stats, latency_count);
+        PIPELINE_COUNT(stats, consumed);
+    }
+
     current_sharetex_index = ndx;
 
+    TRACE_BEGIN(TRACE_DISPLAY);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     setClearColor(0, 1, 0, 1);  // dark green
     glClear(GL_COLOR_BUFFER_BIT);
 
-    renderLockedSharedTexture(sharetex[current_sharetex_index], renderSharedTexture);
+    renderLockedSharedTexture(current_sharetex_index, renderSharedTexture);
 
     glMatrixLoadIdentityEXT(GL_TEXTURE);
     glDisable(GL_TEXTURE_2D);
-    handleFPS(&fps_ctx);
+    double fps = handleFPS(&fps_ctx);
+    if (show_hud) {
+        setHUDmetric(&hud_ctx, hud_fps, fps);
+        setHUDmetric(&hud_ctx, hud_ring_depth, sharedData->produceCount - sharedData->consumeCount);
+        setHUDmetric(&hud_ctx, hud_dropped, frames_skipped);
+        FPSstats window;
+        getFPSstats(&fps_ctx.counter, &window, NULL);
+        setHUDmetric(&hud_ctx, hud_p99, window.p99);
+        setHUDmetric(&hud_ctx, hud_latency, last_latency_us / 1000.0);
+        setHUDmetric(&hud_ctx, hud_late, window.over_budget);
+        drawHUD(&hud_ctx);
+    }
+    if (show_graph) {
+        drawFPSgraph(&fps_ctx, &frame_graph);
+    }
+    TRACE_END(TRACE_DISPLAY);
 
+    TRACE_BEGIN(TRACE_SWAP);
     glutSwapBuffers();
+    TRACE_END(TRACE_SWAP);
 
     while (sharedData->produceCount - sharedData->consumeCount > 1) {
         UINT32 ndx = sharedData->consumeCount % render_buffer_count;
         logf("skipping index = %d", ndx);
+        TRACE_INSTANT(TRACE_SKIP, ndx);
+        if (sharedData->consumeCount != last_consumed) {
+            PIPELINE_COUNT(&sharedData->stats, skipped);  // never displayed
+            frames_skipped++;
+        }
         InterlockedIncrement(&sharedData->consumeCount);
     }
 }
@@ -771,6 +888,11 @@ void startRendererProcess(HANDLE map_file_handle)
     logf("startRendererProcess: map_file_handle = %p", map_file_handle);
     sharedData = (SharedData*)MapViewOfFile(map_file_handle, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedData));
     logf("sharedData=0x%p", sharedData);
+    initTraceRing(&sharedData->renderer_trace, "renderer", GetCurrentProcessId());
+    trace_ring = &sharedData->renderer_trace;
+    sharedData->stats.pid[PIPELINE_RENDERER] = GetCurrentProcessId();
+    initSlotSync(&slot_sync, &dx_interop_sync, NULL, SLOT_SYNC_RENDERER,
+        sharedData->slot_sync, MAX_RENDER_BUFFER, /*reset*/0);
     logf("width = %d", sharedData->width);
     logf("height = %d", sharedData->height);
     logf("render_buffer_count = %d", sharedData->render_buffer_count);
@@ -813,10 +935,57 @@ void renderSceneToTexture(SharedTexture& tex)
     }
 }
 
+// Master merges its own and the renderer's trace rings.
+static void writeTrace(const char *filename)
+{
+    const TraceRing *rings[2] = { &sharedData->master_trace, &sharedData->renderer_trace };
+
+    if (writeChromeTrace(filename, rings, 2)) {
+        reportf("wrote trace to %s", filename);
+    } else {
+        reportf("could not write trace to %s", filename);
+    }
+}
+
+// Where each process's lock time went, per shared texture.
+static void reportSlotSync()
+{
+    static const char *process_name[SLOT_SYNC_PROCESSES] = { "master", "renderer" };
+
+    for (int i=0; i<render_buffer_count; i++) {
+        const SlotSyncStats *stats = &sharedData->slot_sync[i];
+
+        for (int p=0; p<SLOT_SYNC_PROCESSES; p++) {
+            FPSstats wait, hold, unlock;
+
+            summarizeFPShistogram(&stats->wait[p], &wait);
+            summarizeFPShistogram(&stats->hold[p], &hold);
+            summarizeFPShistogram(&stats->unlock[p], &unlock);
+            reportf("slot %d %s: %u locks, %u contended, %u waits over 1 ms; "
+                "ms wait p99 %0.3f max %0.3f, hold p99 %0.3f max %0.3f, unlock p99 %0.3f max %0.3f",
+                i, process_name[p], wait.frames, stats->contended[p], wait.over_budget,
+                wait.p99, wait.max, hold.p99, hold.max, unlock.p99, unlock.max);
+        }
+        if (stats->inversions) {
+            reportf("slot %d: master waited on the renderer %u times (priority inversion)",
+                i, stats->inversions);
+        }
+    }
+}
+
 // Master's atexit callback
 static void masterExitCalled()
 {
     sharedData->renderer_should_terminate = true;
+    if (trace_filename) {
+        writeTrace(trace_filename);
+    }
+
+    FPSstats total;
+    getFPSstats(&fps_ctx.counter, NULL, &total);
+    reportf("%u frames, %u over budget; ms p50 %0.2f p90 %0.2f p99 %0.2f p99.9 %0.2f max %0.2f",
+        total.frames, total.over_budget, total.p50, total.p90, total.p99, total.p999, total.max);
+    reportSlotSync();
 }
 
 // Renderer's atexit callback
@@ -834,21 +1003,34 @@ void generateNewFrame()
 
     if (sharedData->produceCount - sharedData->consumeCount == render_buffer_count) {
         logf("FIFO backed up!");
+        TRACE_INSTANT(TRACE_FIFO_FULL, sharedData->produceCount);
+        PIPELINE_COUNT(&sharedData->stats, fifo_full);
         return;
     }
 
     UINT32 ndx = sharedData->produceCount % render_buffer_count;
     logf("produce to index %d", ndx);
 
-    renderLockedSharedTexture(sharetex[ndx], renderSceneToTexture);
+    TRACE_BEGIN(TRACE_RENDER);
+    renderLockedSharedTexture(ndx, renderSceneToTexture);
+    TRACE_END(TRACE_RENDER);
 
+    // Stamped before the increment, whose full barrier publishes it.
+    sharedData->stats.publish_us[ndx] = statsMicroseconds();
     InterlockedIncrement(&sharedData->produceCount);
+    PIPELINE_COUNT(&sharedData->stats, produced);
+    TRACE_INSTANT(TRACE_PUBLISH, ndx);
+    just_handleFPS(&produce_counter);
 }
 
+// The renderer's frame timer; re-armed from its own callback, and moved
+// when the interval changes so the new rate applies at once.
+static int render_timer = 0;
+
 void delayGenerateNewFrame(int value)
 {
     generateNewFrame();
-    glutTimerFunc(sharedData->render_interval, delayGenerateNewFrame, 0);
+    glutRescheduleTimer(render_timer, sharedData->render_interval);
     if (sharedData->timer_updates_renderer_window) {
         glutPostRedisplay();
     }
@@ -899,6 +1081,9 @@ void keyboard(unsigned char c, int x, int y)
             sharedData->render_interval += 100;
         }
         reportf("render_interval = %d", sharedData->render_interval);
+        if (i_am_renderer) {
+            glutRescheduleTimer(render_timer, sharedData->render_interval);
+        }
         return;
     case '-':
     case '_':
@@ -909,6 +1094,9 @@ void keyboard(unsigned char c, int x, int y)
             sharedData->render_interval = sharedData->render_interval - 100;
         }
         reportf("render_interval = %d", sharedData->render_interval);
+        if (i_am_renderer) {
+            glutRescheduleTimer(render_timer, sharedData->render_interval);
+        }
         return;
     case 'l':
         sharedData->logging = !sharedData->logging;
@@ -923,7 +1111,39 @@ void keyboard(unsigned char c, int x, int y)
         }
         break;
     case 'm':
-        toggleFPSunits();
+        toggleFPSunits(&fps_ctx);
+        return;
+    case 'r':
+        resetFPSstats(&fps_ctx.counter);
+        break;
+    case 'g':
+        if (i_am_master) {
+            show_graph = !show_graph;
+        }
+        break;
+    case 'T':
+        if (i_am_master) {
+            writeTrace(trace_filename ? trace_filename : "interop_trace.json");
+        }
+        return;
+    case 'h':
+        if (i_am_master) {
+            show_hud = !show_hud;
+        }
+        break;
+    case 'L':
+        {
+            GLUTnanoseconds cpu, elapsed;
+            int wakeups = glutGetMainLoopLoad(&cpu, &elapsed, 1);
+            double seconds = elapsed * 1e-9;
+
+            if (seconds > 0) {
+                reportf("main loop: %.1f%% CPU, %.0f wakeups/s over %.1f seconds",
+                    100.0 * cpu / elapsed, wakeups / seconds, seconds);
+            }
+            reportf("make current: %d calls, %d avoided",
+                glutGet(GLUT_CONTEXT_SWITCHES), glutGet(GLUT_CONTEXT_SWITCHES_AVOIDED));
+        }
         return;
     case 'v':
         swap_interval = !swap_interval;
@@ -968,6 +1188,8 @@ void initMaster(const char *program_name)
     createSharedTextures();
 
     spawnRendererProcess(program_name);
+    // Polling for new frames more than once per refresh only burns a core.
+    glutIdlePolicy(idle_policy, idle_interval);
     glutIdleFunc(idleMaster);
 }
 
@@ -1048,7 +1270,7 @@ void initRenderer()
     establishRendererSharedTextures();
 
     generateNewFrame();
-    glutTimerFunc(sharedData->render_interval, delayGenerateNewFrame, 0);
+    render_timer = glutScheduleTimer(sharedData->render_interval, delayGenerateNewFrame, 0);
 }
 
 static int findExtension(const char *extension, const char *extensions)
@@ -1105,6 +1327,7 @@ int WGLExtensionSupported(const char *extension)
 int main(int argc, char *argv[])
 {
     glutInit(&argc, argv);
+    startAsyncLog(stdout);
     // Search for flag to spawn renderer process.
     for (int i=1; i<argc; i++) {
         if (!strcmp(argv[i], SPAWN_RENDERER_FLAG) && argv[i+1] != NULL) {
@@ -1140,6 +1363,11 @@ int main(int argc, char *argv[])
             logging = true;
             continue;
         }
+        if (!strcmp(argv[i], "-trace") && argv[i + 1] != NULL) {
+            trace_filename = argv[i+1];
+            i++;
+            continue;
+        }
         if (!strcmp(argv[i], "-buffers") && argv[i + 1] != NULL) {
             render_buffer_count = atoi(argv[i+1]);
             render_buffer_count = max(2, min(render_buffer_count, 4));
@@ -1156,7 +1384,22 @@ int main(int argc, char *argv[])
             i++;
             continue;
         }
-        printf("usage: %s [-novsync] [-log] [-buffers 2/3/4] [-nomipmap]\n", program_name);
+        if (!strcmp(argv[i], "-idle") && argv[i + 1] != NULL) {
+            const char *policy = argv[i + 1];
+            if (!strcmp(policy, "continuous")) {
+                idle_policy = GLUT_IDLE_CONTINUOUS;
+            } else if (!strcmp(policy, "refresh")) {
+                idle_policy = GLUT_IDLE_REFRESH;
+            } else if (!strcmp(policy, "events")) {
+                idle_policy = GLUT_IDLE_AFTER_EVENTS;
+            } else {
+                idle_policy = GLUT_IDLE_INTERVAL;
+                idle_interval = (GLUTnanoseconds)(atof(policy) * 1000);
+            }
+            i++;
+            continue;
+        }
+        printf("usage: %s [-novsync] [-log] [-trace file.json] [-buffers 2/3/4] [-nomipmap] [-idle continuous/refresh/events/us]\n", program_name);
         exit(1);
     }
     glutInitWindowSize(window_width, window_height);
@@ -1192,6 +1435,10 @@ int main(int argc, char *argv[])
     glutKeyboardFunc(keyboard);
     glutCreateMenu(menu);
     glutAddMenuEntry("[m] Toggle fps vs. milliseconds", 'm');
+    glutAddMenuEntry("[h] Toggle heads-up display", 'h');
+    glutAddMenuEntry("[g] Toggle frame time graph", 'g');
+    glutAddMenuEntry("[r] Reset frame time statistics", 'r');
+    glutAddMenuEntry("[T] Write trace JSON", 'T');
     glutAddMenuEntry("[v] Toggle frame synchronization", 'v');
     glutAddMenuEntry("[o] Cycle objects", 'o');
     glutAddMenuEntry("[t] Toggle timer updates renderer window", 't');
@@ -1216,7 +1463,21 @@ int main(int argc, char *argv[])
 
     initFPScontext(&fps_ctx, FPS_USAGE_TEXTURE);
     if (i_am_master) {
-        enableFPS();
+        enableFPS(&fps_ctx);
+        initHUDcontext(&hud_ctx, FPS_UPPER_LEFT);
+        hud_fps = addHUDmetric(&hud_ctx, "fps", "%0.1f", 1, 1, 0);
+        hud_ring_depth = addHUDmetric(&hud_ctx, "ring", "%0.0f", 0, 1, 1);
+        hud_dropped = addHUDmetric(&hud_ctx, "drop", "%0.0f", 1, 0.5f, 0.5f);
+        hud_p99 = addHUDmetric(&hud_ctx, "p99", "%0.1f ms", 1, 1, 1);
+        hud_latency = addHUDmetric(&hud_ctx, "latency", "%0.1f ms", 1, 1, 1);
+        hud_late = addHUDmetric(&hud_ctx, "late", "%0.0f", 1, 0.5f, 0.5f);
+        fps_ctx.counter.ring = &master_frames;
+        initFPSgraph(&frame_graph, 50, 150);
+        addFPSgraphRing(&frame_graph, &master_frames, 1, 1, 0);
+        addFPSgraphRing(&frame_graph, &sharedData->renderer_frames, 0, 1, 1);
+    } else {
+        initFPScounter(&produce_counter);
+        produce_counter.ring = &sharedData->renderer_frames;
     }
 
     logf("start glutMainLoop");
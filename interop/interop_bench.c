@@ -0,0 +1,777 @@
+
+/* interop_bench.c - headless benchmark of the master/renderer frame ring */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+// Runs the renderer (producer) and master (consumer) roles as two
+// threads around the same ring protocol interop.cpp uses: produceCount
+// and consumeCount, a renderer that skips its tick when every buffer
+// is in use, and a master that holds the buffer it last displayed.
+// No window or GPU is involved; frames are CPU buffers the producer
+// fills and the consumer reads, or with -stub just ring indices.
+//
+// Every combination of the swept parameters runs for -seconds and
+// appends one CSV row, so a change to the pipeline can be compared
+// against a baseline run:
+//
+//   interop_bench [-depth 2..4] [-size 256,1024] [-render 0,10,16.667]
+//                 [-display 16.667] [-policy fifo,mailbox] [-seconds 2]
+//                 [-stub] [-o results.csv]
+//
+// Lists are comma separated; a..b ranges step by one, except for
+// -size, where they double, so "-depth 2..3 -size 256..1024" runs
+// depths 2 and 3 at sizes 256, 512, and 1024.
+//
+// With -srgb it instead times the batch sRGB conversions of sRGB_math.c
+// on frames of each -size, writing their rate in Gpixels/s and their
+// largest error against the single component functions.  It also
+// times convertImage turning a premultiplied sRGB BGRA byte frame into
+// straight linear RGBA floats, on one thread and on -threads (default
+// one per processor), against doing the same in separate passes.
+// -check repeats all of that for every instruction set available and
+// exits nonzero if any error exceeds its bound.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>  /* for CreateThread, waitable timers, and Interlocked operations */
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+#include "trace.h"  // for traceClock
+#include "sRGB_math.h"
+#include "imageconvert.h"
+
+#define BENCH_MAX_DEPTH 16
+#define BENCH_MAX_VALUES 32
+
+typedef enum {
+    BENCH_FIFO,     // master shows every frame, in order
+    BENCH_MAILBOX   // master shows the newest frame, skipping older ones
+} BenchPolicy;
+
+static const char *policy_name[] = { "fifo", "mailbox" };
+
+typedef struct _BenchSlot {
+    unsigned long long publish_ns;
+    unsigned char *pixels;
+} BenchSlot;
+
+typedef struct _BenchRun {
+    BenchPolicy policy;
+    unsigned int depth;
+    int size;
+    double render_ms;
+    double display_ms;
+    int stub;
+
+    // The ring, as in SharedData.
+    volatile unsigned int produce_count;
+    volatile unsigned int consume_count;
+    BenchSlot slot[BENCH_MAX_DEPTH];
+    volatile int stop;
+    double seconds;               // measured length of the run
+
+    // Renderer results
+    unsigned int produced;
+    unsigned int fifo_full;
+    unsigned long long producer_cpu_ns;
+
+    // Master results
+    unsigned int consumed;
+    unsigned int skipped;
+    unsigned int repeats;         // displays of a frame already shown
+    unsigned int torn;            // frames overwritten while displayed
+    unsigned long long consumer_cpu_ns;
+    unsigned int *latency_ns;     // publish to first display, per consumed frame
+    unsigned int latency_capacity;
+} BenchRun;
+
+#ifdef _WIN32
+#define barrier() MemoryBarrier()
+#define atomicIncrement(p) InterlockedIncrement((volatile LONG*)(p))
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#define barrier() __sync_synchronize()
+#define atomicIncrement(p) __sync_add_and_fetch(p, 1)
+#endif
+
+static unsigned long long threadCPUTime(void)
+{
+#ifdef _WIN32
+    FILETIME creation, exited, kernel, user;
+    ULARGE_INTEGER k, u;
+
+    GetThreadTimes(GetCurrentThread(), &creation, &exited, &kernel, &user);
+    k.LowPart = kernel.dwLowDateTime, k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime, u.HighPart = user.dwHighDateTime;
+    return (k.QuadPart + u.QuadPart) * 100;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (unsigned long long)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+// Blocks, without spinning, until traceClock reaches deadline.
+static void sleepUntil(unsigned long long deadline)
+{
+#ifdef _WIN32
+    static __declspec(thread) HANDLE timer;
+    const unsigned long long now = traceClock();
+    LARGE_INTEGER due;
+
+    if (now >= deadline) {
+        return;
+    }
+    if (!timer) {
+        // High resolution timers need Windows 10 1803; older ones round up to the tick.
+        timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (!timer) {
+            timer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+        }
+    }
+    due.QuadPart = -(LONGLONG)((deadline - now + 99) / 100);  // relative, 100 ns units
+    SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE);
+    WaitForSingleObject(timer, INFINITE);
+#else
+    struct timespec ts;
+
+    ts.tv_sec = deadline / 1000000000;
+    ts.tv_nsec = deadline % 1000000000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL)) {
+        // interrupted; sleep the rest
+    }
+#endif
+}
+
+// With a zero interval a role polls; let the other one run meanwhile.
+static void yieldThread(void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+static size_t frameBytes(const BenchRun *run)
+{
+    return (size_t)run->size * run->size * 4;
+}
+
+// Stands in for renderSceneToTexture: writes every byte, with the
+// frame number at both ends so the master can detect tearing.
+static void renderCPUFrame(BenchRun *run, BenchSlot *slot, unsigned int frame)
+{
+    const size_t bytes = frameBytes(run);
+
+    memset(slot->pixels, frame & 0xff, bytes);
+    memcpy(slot->pixels, &frame, sizeof(frame));
+    memcpy(slot->pixels + bytes - sizeof(frame), &frame, sizeof(frame));
+}
+
+static volatile unsigned int sink;
+
+// Stands in for texturing from the shared texture: reads every cache
+// line.  Returns zero if the frame changed while it was read.
+static int displayCPUFrame(BenchRun *run, const BenchSlot *slot, unsigned int frame)
+{
+    const size_t bytes = frameBytes(run);
+    unsigned int sum = 0, first, last;
+    size_t i;
+
+    memcpy(&first, slot->pixels, sizeof(first));
+    for (i=0; i<bytes; i+=64) {
+        sum += slot->pixels[i];
+    }
+    sink = sum;
+    memcpy(&last, slot->pixels + bytes - sizeof(last), sizeof(last));
+    return first == frame && last == frame;
+}
+
+// The renderer's generateNewFrame and delayGenerateNewFrame.
+#ifdef _WIN32
+static DWORD WINAPI producer(LPVOID arg)
+#else
+static void *producer(void *arg)
+#endif
+{
+    BenchRun *run = (BenchRun*)arg;
+    const unsigned long long interval = (unsigned long long)(run->render_ms * 1e6);
+    const unsigned long long cpu_start = threadCPUTime();
+
+    while (!run->stop) {
+        const unsigned int produce_count = run->produce_count;
+
+        if (produce_count - run->consume_count == run->depth) {
+            run->fifo_full++;
+        } else {
+            BenchSlot *slot = &run->slot[produce_count % run->depth];
+
+            if (!run->stub) {
+                renderCPUFrame(run, slot, produce_count);
+            }
+            slot->publish_ns = traceClock();
+            atomicIncrement(&run->produce_count);  // full barrier publishes the frame
+            run->produced++;
+        }
+        // glutTimerFunc counts the interval from after the frame.
+        if (interval) {
+            sleepUntil(traceClock() + interval);
+        } else {
+            yieldThread();
+        }
+    }
+    run->producer_cpu_ns = threadCPUTime() - cpu_start;
+    return 0;
+}
+
+static void recordLatency(BenchRun *run, unsigned long long ns)
+{
+    if (run->consumed >= run->latency_capacity) {
+        unsigned int capacity = run->latency_capacity ? 2*run->latency_capacity : 4096;
+        unsigned int *latency = (unsigned int*)realloc(run->latency_ns, capacity * sizeof(*latency));
+
+        if (!latency) {
+            return;
+        }
+        run->latency_ns = latency;
+        run->latency_capacity = capacity;
+    }
+    run->latency_ns[run->consumed] = ns > 0xffffffffu ? 0xffffffffu : (unsigned int)ns;
+}
+
+// The master's displayMaster, one call per vertical refresh.
+#ifdef _WIN32
+static DWORD WINAPI consumer(LPVOID arg)
+#else
+static void *consumer(void *arg)
+#endif
+{
+    BenchRun *run = (BenchRun*)arg;
+    const unsigned long long interval = (unsigned long long)(run->display_ms * 1e6);
+    const unsigned long long cpu_start = threadCPUTime();
+    unsigned long long next = traceClock();
+    unsigned int last_consumed = ~0u;
+
+    while (!run->stop) {
+        if (run->produce_count - run->consume_count >= 1) {
+            const unsigned int consume_count = run->consume_count;
+            const BenchSlot *slot = &run->slot[consume_count % run->depth];
+
+            barrier();  // read the frame only after seeing it published
+            if (consume_count != last_consumed) {
+                recordLatency(run, traceClock() - slot->publish_ns);
+                run->consumed++;
+                last_consumed = consume_count;
+            } else {
+                run->repeats++;
+            }
+            if (!run->stub && !displayCPUFrame(run, slot, consume_count)) {
+                run->torn++;
+            }
+            if (run->policy == BENCH_MAILBOX) {
+                while (run->produce_count - run->consume_count > 1) {
+                    if (run->consume_count != last_consumed) {
+                        run->skipped++;
+                    }
+                    atomicIncrement(&run->consume_count);
+                }
+            } else if (run->produce_count - run->consume_count > 1) {
+                atomicIncrement(&run->consume_count);
+            }
+        }
+        // Refreshes keep their cadence; ones missed are dropped, like vsync.
+        if (interval) {
+            const unsigned long long now = traceClock();
+
+            next += interval;
+            if (next < now) {
+                next += (now - next) / interval * interval + interval;
+            }
+            sleepUntil(next);
+        } else {
+            yieldThread();
+        }
+    }
+    run->consumer_cpu_ns = threadCPUTime() - cpu_start;
+    return 0;
+}
+
+static int compareUint(const void *a, const void *b)
+{
+    const unsigned int x = *(const unsigned int*)a, y = *(const unsigned int*)b;
+    return x < y ? -1 : x > y;
+}
+
+static double latencyPercentile(const BenchRun *run, double p)
+{
+    const unsigned int n = run->consumed < run->latency_capacity ? run->consumed : run->latency_capacity;
+
+    if (n == 0) {
+        return 0;
+    }
+    return run->latency_ns[(unsigned int)(p * (n-1) + 0.5)] / 1e6;
+}
+
+// Returns zero if the frames could not be allocated.
+static int runBench(BenchRun *run, double seconds)
+{
+    const size_t bytes = run->stub ? 0 : frameBytes(run);
+    unsigned long long start;
+    unsigned int i;
+#ifdef _WIN32
+    HANDLE thread[2];
+#else
+    pthread_t thread[2];
+#endif
+
+    for (i=0; i<run->depth; i++) {
+        run->slot[i].pixels = NULL;
+        if (bytes) {
+            run->slot[i].pixels = (unsigned char*)malloc(bytes);
+            if (!run->slot[i].pixels) {
+                while (i-- > 0) {
+                    free(run->slot[i].pixels);
+                }
+                return 0;
+            }
+            memset(run->slot[i].pixels, 0xff, bytes);  // fault pages in before timing
+        }
+    }
+
+    start = traceClock();
+#ifdef _WIN32
+    thread[0] = CreateThread(NULL, 0, producer, run, 0, NULL);
+    thread[1] = CreateThread(NULL, 0, consumer, run, 0, NULL);
+    Sleep((DWORD)(seconds * 1000));
+    run->stop = 1;
+    WaitForMultipleObjects(2, thread, TRUE, INFINITE);
+    CloseHandle(thread[0]);
+    CloseHandle(thread[1]);
+#else
+    pthread_create(&thread[0], NULL, producer, run);
+    pthread_create(&thread[1], NULL, consumer, run);
+    sleepUntil(start + (unsigned long long)(seconds * 1e9));
+    run->stop = 1;
+    pthread_join(thread[0], NULL);
+    pthread_join(thread[1], NULL);
+#endif
+    run->seconds = (traceClock() - start) / 1e9;
+
+    for (i=0; i<run->depth; i++) {
+        free(run->slot[i].pixels);
+    }
+    qsort(run->latency_ns, run->consumed < run->latency_capacity ? run->consumed : run->latency_capacity,
+        sizeof(run->latency_ns[0]), compareUint);
+    return 1;
+}
+
+static void writeHeader(FILE *out)
+{
+    fprintf(out, "policy,depth,size,render_ms,display_ms,seconds,"
+        "produced_fps,consumed_fps,drop_rate,fifo_full_rate,repeat_rate,"
+        "latency_p50_ms,latency_p90_ms,latency_p99_ms,latency_max_ms,"
+        "producer_cpu_us_per_frame,consumer_cpu_us_per_frame,torn\n");
+}
+
+static void writeRow(FILE *out, const BenchRun *run)
+{
+    const double seconds = run->seconds;
+    const unsigned int displays = run->consumed + run->repeats;
+    const unsigned int producer_ticks = run->produced + run->fifo_full;
+
+    fprintf(out, "%s,%u,%d,%g,%g,%.3f,%.1f,%.1f,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%u\n",
+        policy_name[run->policy], run->depth, run->size, run->render_ms, run->display_ms, seconds,
+        run->produced / seconds, run->consumed / seconds,
+        run->produced ? (double)run->skipped / run->produced : 0,
+        producer_ticks ? (double)run->fifo_full / producer_ticks : 0,
+        displays ? (double)run->repeats / displays : 0,
+        latencyPercentile(run, 0.50), latencyPercentile(run, 0.90),
+        latencyPercentile(run, 0.99), latencyPercentile(run, 1.0),
+        run->produced ? run->producer_cpu_ns / 1e3 / run->produced : 0,
+        run->consumed ? run->consumer_cpu_ns / 1e3 / run->consumed : 0,
+        run->torn);
+    fflush(out);
+}
+
+typedef enum {
+    SRGB_ENCODE_F,
+    SRGB_ENCODE_UB,
+    SRGB_DECODE_F,
+    SRGB_DECODE_UB,
+    SRGB_KERNELS
+} SRGBkernel;
+
+static const char *srgb_kernel_name[SRGB_KERNELS] = {
+    "convertLinearToSRGBf",
+    "convertLinearToSRGBub",
+    "convertSRGBToLinearf",
+    "convertSRGBubToLinearf"
+};
+
+// Largest error each kernel may have: sRGB_math.h's 2e-6 relative for
+// floats; the unsigned byte forms are exact.
+static const double srgb_kernel_bound[SRGB_KERNELS] = { 2e-6, 0, 2e-6, 0 };
+
+// convertImage against the separate passes, both within 2e-6 of exact.
+#define CONVERT_IMAGE_BOUND 4e-6
+
+static void runSRGBKernel(SRGBkernel kernel, float *f, unsigned char *ub, float *out, size_t pixels)
+{
+    switch (kernel) {
+    case SRGB_ENCODE_F:
+        convertLinearToSRGBf(out, f, pixels);
+        break;
+    case SRGB_ENCODE_UB:
+        convertLinearToSRGBub(ub, f, pixels);
+        break;
+    case SRGB_DECODE_F:
+        convertSRGBToLinearf(out, f, pixels);
+        break;
+    default:
+        convertSRGBubToLinearf(out, ub, pixels);
+        break;
+    }
+}
+
+// Largest error of a kernel's color components against the single
+// component function: relative for floats (absolute below 1e-3),
+// in steps for unsigned bytes.
+static double srgbKernelError(SRGBkernel kernel, const float *f, const unsigned char *ub,
+                              const float *out, const unsigned char *ub_out, size_t pixels)
+{
+    double worst = 0;
+    size_t i;
+
+    for (i=0; i<4*pixels; i++) {
+        double error;
+
+        if ((i & 3) == 3) {
+            continue;  // alpha
+        }
+        if (kernel == SRGB_ENCODE_UB) {
+            error = fabs((double)ub_out[i] - convertLinearColorComponentToSRGBub(f[i]));
+        } else {
+            const float ref = kernel == SRGB_ENCODE_F ? convertLinearColorComponentToSRGBf(f[i]) :
+                              kernel == SRGB_DECODE_F ? convertSRGBColorComponentToLinearf(f[i]) :
+                              convertSRGBColorComponentUBToLinearf(ub[i]);
+            error = fabs((double)out[i] - ref) / (fabs(ref) > 1e-3 ? fabs(ref) : 1e-3);
+        }
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    return worst;
+}
+
+// The premultiplied sRGB BGRA to linear RGBA conversion benchSRGB
+// times, one step per pass over the frame.
+static void convertImageInPasses(float *dst, const unsigned char *src, size_t pixels)
+{
+    size_t i;
+
+    for (i=0; i<4*pixels; i+=4) {
+        dst[i+0] = src[i+2] * (1.0f/255.0f);
+        dst[i+1] = src[i+1] * (1.0f/255.0f);
+        dst[i+2] = src[i+0] * (1.0f/255.0f);
+        dst[i+3] = src[i+3] * (1.0f/255.0f);
+    }
+    for (i=0; i<4*pixels; i+=4) {
+        const float scale = dst[i+3] > 0.0f ? 1.0f/dst[i+3] : 0.0f;
+
+        dst[i+0] *= scale;
+        dst[i+1] *= scale;
+        dst[i+2] *= scale;
+    }
+    convertSRGBToLinearf(dst, dst, pixels);
+}
+
+// Largest relative error (absolute below 1e-3) of out against ref.
+static double relativeError(const float *out, const float *ref, size_t count)
+{
+    double worst = 0;
+    size_t i;
+
+    for (i=0; i<count; i++) {
+        const double error = fabs((double)out[i] - ref[i]) / (fabs(ref[i]) > 1e-3 ? fabs(ref[i]) : 1e-3);
+
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    return worst;
+}
+
+// With -check, counts and reports an error over its bound.
+static void checkBound(int *failures, const char *kernel, int size, double error, double bound)
+{
+    if (failures && error > bound) {
+        fprintf(stderr, "%s %s %dx%d: error %.3g exceeds %.3g\n",
+            kernel, sRGBBatchInstructionSet(), size, size, error, bound);
+        (*failures)++;
+    }
+}
+
+// Returns nonzero if the frames could be allocated.  failures, if not
+// NULL, counts errors over their bounds.
+static int benchSRGB(FILE *out, int size, double seconds, ImageConverter *converter, int *failures)
+{
+    const size_t pixels = (size_t)size * size;
+    float *f = (float*)malloc(4*pixels * sizeof(float));
+    float *converted = (float*)malloc(4*pixels * sizeof(float));
+    unsigned char *ub = (unsigned char*)malloc(4*pixels);
+    unsigned char *ub_out = (unsigned char*)malloc(4*pixels);
+    ImageDesc linear = { NULL, 0, 0, 0, IMAGE_FLOAT, IMAGE_RGBA, 0 };
+    ImageDesc premultiplied = { NULL, 0, 0, 0, IMAGE_UNSIGNED_BYTE, IMAGE_BGRA, IMAGE_SRGB | IMAGE_PREMULTIPLIED };
+    size_t i;
+    int k;
+
+    if (!f || !converted || !ub || !ub_out) {
+        free(f), free(converted), free(ub), free(ub_out);
+        return 0;
+    }
+    srand(size);
+    for (i=0; i<4*pixels; i++) {
+        f[i] = rand() / (float)RAND_MAX;
+        ub[i] = (unsigned char)rand();
+    }
+    for (k=0; k<SRGB_KERNELS; k++) {
+        const unsigned long long start = traceClock();
+        unsigned long long elapsed;
+        unsigned int runs = 0;
+        double error;
+
+        do {
+            runSRGBKernel((SRGBkernel)k, f, k == SRGB_ENCODE_UB ? ub_out : ub, converted, pixels);
+            runs++;
+            elapsed = traceClock() - start;
+        } while (elapsed < seconds * 1e9);
+        error = srgbKernelError((SRGBkernel)k, f, ub, converted, ub_out, pixels);
+        checkBound(failures, srgb_kernel_name[k], size, error, srgb_kernel_bound[k]);
+        fprintf(out, "%s,%s,1,%d,%.3f,%.3g\n", srgb_kernel_name[k], sRGBBatchInstructionSet(), size,
+            (double)runs * pixels / elapsed, error);
+        fflush(out);
+    }
+
+    // ub becomes premultiplied, and f the separate passes' result.
+    for (i=0; i<4*pixels; i+=4) {
+        const unsigned int alpha = ub[i+3];
+
+        ub[i+0] = (unsigned char)((ub[i+0] * alpha + 127) / 255);
+        ub[i+1] = (unsigned char)((ub[i+1] * alpha + 127) / 255);
+        ub[i+2] = (unsigned char)((ub[i+2] * alpha + 127) / 255);
+    }
+    linear.pixels = converted;
+    premultiplied.pixels = ub;
+    linear.width = linear.height = premultiplied.width = premultiplied.height = size;
+    for (k=0; k<3; k++) {
+        const unsigned long long start = traceClock();
+        unsigned long long elapsed;
+        unsigned int runs = 0;
+        double error;
+
+        if (k == 2 && imageConverterThreads(converter) == 1) {
+            break;
+        }
+        do {
+            if (k == 0) {
+                convertImageInPasses(f, ub, pixels);
+            } else {
+                convertImage(k == 1 ? NULL : converter, &linear, &premultiplied);
+            }
+            runs++;
+            elapsed = traceClock() - start;
+        } while (elapsed < seconds * 1e9);
+        error = k ? relativeError(converted, f, 4*pixels) : 0.0;
+        checkBound(failures, "convertImage", size, error, CONVERT_IMAGE_BOUND);
+        fprintf(out, "%s,%s,%d,%d,%.3f,%.3g\n", k ? "convertImage" : "convertImageInPasses",
+            sRGBBatchInstructionSet(), k == 2 ? imageConverterThreads(converter) : 1, size,
+            (double)runs * pixels / elapsed, error);
+        fflush(out);
+    }
+    free(f), free(converted), free(ub), free(ub_out);
+    return 1;
+}
+
+// Parses "a,b,c" and "a..b" into values; returns how many.
+static int parseList(const char *list, double *values, int doubling)
+{
+    int count = 0;
+
+    while (*list && count < BENCH_MAX_VALUES) {
+        const char *dots = strstr(list, "..");
+        const char *comma = strchr(list, ',');
+        char *end;
+        double lo = strtod(list, &end), hi;
+
+        if (end == list) {
+            break;
+        }
+        hi = lo;
+        // strtod reads "2..4" as "2." and ".4", so look for the range
+        // in the text instead of where the first number stopped.
+        if (dots && (!comma || dots < comma)) {
+            hi = strtod(dots + 2, &end);
+            if (end == dots + 2) {
+                break;
+            }
+        }
+        for (; lo <= hi && count < BENCH_MAX_VALUES; lo = doubling ? lo*2 : lo+1) {
+            values[count++] = lo;
+            if (doubling && lo <= 0) {
+                break;
+            }
+        }
+        list = *end == ',' ? end+1 : end;
+    }
+    return count;
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr,
+        "usage: %s [-depth 2..4] [-size 256,1024] [-render 0,10,16.667] [-display 16.667]\n"
+        "       [-policy fifo,mailbox] [-seconds 2] [-stub] [-o results.csv]\n"
+        "   or: %s -srgb [-size 256,1024] [-seconds 2] [-threads n] [-check] [-o results.csv]\n"
+        "e.g.:  %s -depth 2..3 -size 256..1024 -render 10 -seconds 1\n", program, program, program);
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    double depth[BENCH_MAX_VALUES] = { 2, 3, 4 };
+    double size[BENCH_MAX_VALUES] = { 256, 1024 };
+    double render_ms[BENCH_MAX_VALUES] = { 0, 10, 16.667 };
+    int depths = 3, sizes = 2, renders = 3;
+    int policy_mask = (1 << BENCH_FIFO) | (1 << BENCH_MAILBOX);
+    double display_ms = 16.667;
+    double seconds = 2;
+    int stub = 0;
+    int srgb = 0;
+    int threads = 0;
+    int check = 0;
+    FILE *out = stdout;
+    int p, d, s, r, i;
+
+    for (i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-depth") && i+1 < argc) {
+            depths = parseList(argv[++i], depth, 0);
+        } else if (!strcmp(argv[i], "-size") && i+1 < argc) {
+            sizes = parseList(argv[++i], size, 1);
+        } else if (!strcmp(argv[i], "-render") && i+1 < argc) {
+            renders = parseList(argv[++i], render_ms, 0);
+        } else if (!strcmp(argv[i], "-display") && i+1 < argc) {
+            display_ms = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "-policy") && i+1 < argc) {
+            const char *list = argv[++i];
+
+            policy_mask = 0;
+            if (strstr(list, "fifo")) {
+                policy_mask |= 1 << BENCH_FIFO;
+            }
+            if (strstr(list, "mailbox")) {
+                policy_mask |= 1 << BENCH_MAILBOX;
+            }
+        } else if (!strcmp(argv[i], "-seconds") && i+1 < argc) {
+            seconds = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "-stub")) {
+            stub = 1;
+        } else if (!strcmp(argv[i], "-srgb")) {
+            srgb = 1;
+        } else if (!strcmp(argv[i], "-check")) {
+            check = 1;
+        } else if (!strcmp(argv[i], "-threads") && i+1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-o") && i+1 < argc) {
+            out = fopen(argv[++i], "w");
+            if (!out) {
+                fprintf(stderr, "%s: cannot write %s\n", argv[0], argv[i]);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (!depths || !sizes || !renders || !policy_mask || seconds <= 0 || display_ms < 0) {
+        usage(argv[0]);
+    }
+
+    if (srgb) {
+        // -check runs every instruction set this build and processor
+        // have, failing if any error exceeds its bound.
+        static const char *instruction_set[] = { "AVX2", "SSE2", "NEON", "scalar" };
+        const char *best = sRGBBatchInstructionSet();
+        ImageConverter *converter = createImageConverter(threads);
+        int failures = 0;
+        int n;
+
+        fprintf(out, "kernel,instruction_set,threads,size,gpixels_per_s,max_error\n");
+        for (n=0; n<(check ? (int)(sizeof(instruction_set)/sizeof(instruction_set[0])) : 1); n++) {
+            if (check && !selectSRGBBatchInstructionSet(instruction_set[n])) {
+                continue;
+            }
+            for (s=0; s<sizes; s++) {
+                const int clamped = size[s] < 32 ? 32 : size[s] > 4096 ? 4096 : (int)size[s];
+
+                if (!benchSRGB(out, clamped, seconds, converter, check ? &failures : NULL)) {
+                    fprintf(stderr, "%s: out of memory for %dx%d frames\n", argv[0], clamped, clamped);
+                }
+            }
+        }
+        selectSRGBBatchInstructionSet(best);
+        destroyImageConverter(converter);
+        if (out != stdout) {
+            fclose(out);
+        }
+        return failures ? 1 : 0;
+    }
+
+    writeHeader(out);
+    for (p=BENCH_FIFO; p<=BENCH_MAILBOX; p++) {
+        if (!(policy_mask & (1 << p))) {
+            continue;
+        }
+        for (d=0; d<depths; d++) {
+            for (s=0; s<sizes; s++) {
+                for (r=0; r<renders; r++) {
+                    BenchRun *run = (BenchRun*)calloc(1, sizeof(BenchRun));
+
+                    if (!run) {
+                        return 1;
+                    }
+                    run->policy = (BenchPolicy)p;
+                    run->depth = depth[d] < 2 ? 2 : depth[d] > BENCH_MAX_DEPTH ? BENCH_MAX_DEPTH : (unsigned int)depth[d];
+                    // Same clamp as interop's -size option.
+                    run->size = size[s] < 32 ? 32 : size[s] > 4096 ? 4096 : (int)size[s];
+                    run->render_ms = render_ms[r] < 0 ? 0 : render_ms[r];
+                    run->display_ms = display_ms;
+                    run->stub = stub;
+                    fprintf(stderr, "%s depth %u size %d render %g ms...\n",
+                        policy_name[p], run->depth, run->size, run->render_ms);
+                    if (runBench(run, seconds)) {
+                        writeRow(out, run);
+                    } else {
+                        fprintf(stderr, "%s: out of memory for %dx%d frames\n", argv[0], run->size, run->size);
+                    }
+                    free(run->latency_ns);
+                    free(run);
+                }
+            }
+        }
+    }
+    if (out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
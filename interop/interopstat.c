@@ -0,0 +1,344 @@
+
+/* interopstat.c - print the pipeline statistics of a running interop master */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+// Attaches read-only to the PipelineStats block at the front of the
+// master's shared mapping (see pipestats.h).  Nothing is locked or
+// written, so watching the pipeline does not change its timing.
+//
+//   interopstat [-interval ms] [-count n] [-prometheus file] [-listen port] [pid]
+//
+// Without a pid, the first running interop.exe is used.  -prometheus
+// rewrites file in Prometheus text format every interval (a textfile
+// collector can pick it up); -listen serves the same text over HTTP on
+// 127.0.0.1:port.
+
+#include <winsock2.h>
+#include <windows.h>
+#include <tlhelp32.h>  // for CreateToolhelp32Snapshot
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pipestats.h"
+
+#define snprintf _snprintf
+
+typedef struct _Snapshot {
+    unsigned int produced;
+    unsigned int fifo_full;
+    unsigned int consumed;
+    unsigned int skipped;
+    unsigned int lock_failures;
+    unsigned int unlock_failures;
+    unsigned int latency_count;
+} Snapshot;
+
+typedef struct _Latency {
+    unsigned int samples;
+    double p50, p90, p99, max;  // milliseconds
+} Latency;
+
+static const volatile PipelineStats *stats;
+static unsigned int latency[PIPELINE_LATENCY_SAMPLES];
+
+static void takeSnapshot(Snapshot *s)
+{
+    s->produced = stats->produced;
+    s->fifo_full = stats->fifo_full;
+    s->consumed = stats->consumed;
+    s->skipped = stats->skipped;
+    s->lock_failures = stats->lock_failures[PIPELINE_MASTER] + stats->lock_failures[PIPELINE_RENDERER];
+    s->unlock_failures = stats->unlock_failures[PIPELINE_MASTER] + stats->unlock_failures[PIPELINE_RENDERER];
+    s->latency_count = stats->latency_count;
+}
+
+static int compareUint(const void *a, const void *b)
+{
+    const unsigned int x = *(const unsigned int*)a, y = *(const unsigned int*)b;
+    return x < y ? -1 : x > y;
+}
+
+static double percentile(unsigned int n, double p)
+{
+    return latency[(unsigned int)(p * (n-1) + 0.5)] / 1000.0;
+}
+
+// Percentiles of the latencies recorded since the previous snapshot,
+// or of as many as the ring still holds.
+static void summarizeLatency(const Snapshot *prev, const Snapshot *now, Latency *l)
+{
+    unsigned int n = now->latency_count - prev->latency_count;
+    unsigned int i;
+
+    if (n > PIPELINE_LATENCY_SAMPLES) {
+        n = PIPELINE_LATENCY_SAMPLES;
+    }
+    for (i=0; i<n; i++) {
+        latency[i] = stats->latency_us[(now->latency_count - n + i) & (PIPELINE_LATENCY_SAMPLES-1)];
+    }
+    l->samples = n;
+    if (n == 0) {
+        l->p50 = l->p90 = l->p99 = l->max = 0;
+        return;
+    }
+    qsort(latency, n, sizeof(latency[0]), compareUint);
+    l->p50 = percentile(n, 0.50);
+    l->p90 = percentile(n, 0.90);
+    l->p99 = percentile(n, 0.99);
+    l->max = latency[n-1] / 1000.0;
+}
+
+static int formatPrometheus(char *text, size_t size, const Snapshot *s, const Latency *l)
+{
+#define COUNTER(name, help) \
+    "# HELP interop_" name " " help "\n# TYPE interop_" name " counter\ninterop_" name " %u\n"
+    int len = snprintf(text, size,
+        COUNTER("frames_produced_total", "Frames the renderer published.")
+        COUNTER("frames_consumed_total", "Frames the master displayed.")
+        COUNTER("frames_skipped_total", "Frames the master dropped without displaying.")
+        COUNTER("fifo_full_total", "Frames the renderer skipped because every buffer was in use.")
+        COUNTER("lock_failures_total", "Failed wglDXLockObjectsNV calls in either process.")
+        COUNTER("unlock_failures_total", "Failed wglDXUnlockObjectsNV calls in either process.")
+        "# HELP interop_frame_latency_seconds Publish to first display of a frame.\n"
+        "# TYPE interop_frame_latency_seconds summary\n"
+        "interop_frame_latency_seconds{quantile=\"0.5\"} %g\n"
+        "interop_frame_latency_seconds{quantile=\"0.9\"} %g\n"
+        "interop_frame_latency_seconds{quantile=\"0.99\"} %g\n"
+        "interop_frame_latency_seconds{quantile=\"1\"} %g\n"
+        "interop_frame_latency_seconds_count %u\n",
+        s->produced, s->consumed, s->skipped, s->fifo_full, s->lock_failures, s->unlock_failures,
+        l->p50 / 1000, l->p90 / 1000, l->p99 / 1000, l->max / 1000, s->latency_count);
+#undef COUNTER
+    return len < 0 ? (int)size - 1 : len;
+}
+
+// Replaces filename whole so a scraper never reads a partial file.
+static void writePrometheus(const char *filename, const char *text, int len)
+{
+    char temp[MAX_PATH];
+    FILE *file;
+
+    snprintf(temp, sizeof(temp), "%s.tmp", filename);
+    temp[sizeof(temp)-1] = '\0';
+    file = fopen(temp, "w");
+    if (!file) {
+        return;
+    }
+    fwrite(text, 1, len, file);
+    if (fclose(file) == 0) {
+        MoveFileExA(temp, filename, MOVEFILE_REPLACE_EXISTING);
+    }
+}
+
+static SOCKET listenOn(int port)
+{
+    struct sockaddr_in addr;
+    WSADATA wsa;
+    SOCKET s;
+
+    if (WSAStartup(MAKEWORD(2, 2), &wsa)) {
+        return INVALID_SOCKET;
+    }
+    s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == INVALID_SOCKET) {
+        return s;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons((unsigned short)port);
+    if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) || listen(s, 4)) {
+        closesocket(s);
+        return INVALID_SOCKET;
+    }
+    return s;
+}
+
+// Answers one scrape with text, whatever was asked for.
+static void serveScrape(SOCKET server, const char *text, int len)
+{
+    SOCKET client = accept(server, NULL, NULL);
+    char header[128];
+    char request[1024];
+    int header_len;
+
+    if (client == INVALID_SOCKET) {
+        return;
+    }
+    recv(client, request, sizeof(request), 0);
+    header_len = snprintf(header, sizeof(header),
+        "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %d\r\n\r\n", len);
+    send(client, header, header_len, 0);
+    send(client, text, len, 0);
+    closesocket(client);
+}
+
+// Sleeps ms milliseconds, answering scrapes on server meanwhile.
+static void waitServing(SOCKET server, DWORD ms, const char *text, int len)
+{
+    const DWORD start = GetTickCount();
+    DWORD waited;
+
+    if (server == INVALID_SOCKET) {
+        Sleep(ms);
+        return;
+    }
+    while ((waited = GetTickCount() - start) < ms) {
+        struct timeval timeout;
+        fd_set ready;
+
+        timeout.tv_sec = (ms - waited) / 1000;
+        timeout.tv_usec = (ms - waited) % 1000 * 1000;
+        FD_ZERO(&ready);
+        FD_SET(server, &ready);
+        if (select(0, &ready, NULL, NULL, &timeout) > 0) {
+            serveScrape(server, text, len);
+        }
+    }
+}
+
+static DWORD findInterop(void)
+{
+    const HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+    PROCESSENTRY32W entry;
+    DWORD pid = 0;
+
+    if (snapshot == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+    entry.dwSize = sizeof(entry);
+    if (Process32FirstW(snapshot, &entry)) {
+        do {
+            if (!_wcsicmp(entry.szExeFile, L"interop.exe") && entry.th32ProcessID != GetCurrentProcessId()) {
+                // The renderer is an interop.exe too, but only the master names a mapping.
+                char name[64];
+                HANDLE mapping;
+
+                snprintf(name, sizeof(name), PIPELINE_STATS_MAPPING, entry.th32ProcessID);
+                mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+                if (mapping) {
+                    CloseHandle(mapping);
+                    pid = entry.th32ProcessID;
+                    break;
+                }
+            }
+        } while (Process32NextW(snapshot, &entry));
+    }
+    CloseHandle(snapshot);
+    return pid;
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [-interval ms] [-count n] [-prometheus file] [-listen port] [pid]\n", program);
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    DWORD interval = 1000;
+    int count = -1;
+    const char *prometheus_file = NULL;
+    int port = 0;
+    DWORD pid = 0;
+    char name[64];
+    HANDLE mapping, master;
+    SOCKET server = INVALID_SOCKET;
+    Snapshot prev, now;
+    char text[4096];
+    int text_len = 0;
+    int line;
+    int i;
+
+    for (i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-interval") && i+1 < argc) {
+            interval = max(10, atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "-count") && i+1 < argc) {
+            count = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-prometheus") && i+1 < argc) {
+            prometheus_file = argv[++i];
+        } else if (!strcmp(argv[i], "-listen") && i+1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (argv[i][0] != '-' && !pid) {
+            pid = strtoul(argv[i], NULL, 0);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (!pid) {
+        pid = findInterop();
+        if (!pid) {
+            fprintf(stderr, "%s: no running interop master found\n", argv[0]);
+            return 1;
+        }
+    }
+
+    snprintf(name, sizeof(name), PIPELINE_STATS_MAPPING, pid);
+    mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (!mapping) {
+        fprintf(stderr, "%s: cannot open %s (error %lu)\n", argv[0], name, GetLastError());
+        return 1;
+    }
+    stats = (const volatile PipelineStats*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, sizeof(PipelineStats));
+    if (!stats) {
+        fprintf(stderr, "%s: cannot map %s (error %lu)\n", argv[0], name, GetLastError());
+        return 1;
+    }
+    if (stats->magic != PIPELINE_STATS_MAGIC || stats->version != PIPELINE_STATS_VERSION ||
+        stats->size < sizeof(PipelineStats)) {
+        fprintf(stderr, "%s: %s has statistics version %u, expected %u\n",
+            argv[0], name, stats->version, PIPELINE_STATS_VERSION);
+        return 1;
+    }
+    if (port) {
+        server = listenOn(port);
+        if (server == INVALID_SOCKET) {
+            fprintf(stderr, "%s: cannot listen on 127.0.0.1:%d\n", argv[0], port);
+            return 1;
+        }
+    }
+    master = OpenProcess(SYNCHRONIZE, FALSE, pid);
+
+    printf("interop master %lu, renderer %u, %u buffers\n",
+        pid, stats->pid[PIPELINE_RENDERER], stats->render_buffer_count);
+    takeSnapshot(&prev);
+    for (line=0; count<0 || line<count; line++) {
+        const DWORD start = GetTickCount();
+        double seconds;
+        Latency l;
+
+        waitServing(server, interval, text, text_len);
+        if (master && WaitForSingleObject(master, 0) == WAIT_OBJECT_0) {
+            printf("interop master %lu exited\n", pid);
+            break;
+        }
+        takeSnapshot(&now);
+        seconds = (GetTickCount() - start) / 1000.0;
+        summarizeLatency(&prev, &now, &l);
+
+        if (line % 20 == 0) {
+            printf("%10s %10s %10s %10s %8s %8s %8s %8s %8s\n",
+                "produced/s", "consumed/s", "skipped/s", "fifofull/s", "lockfail",
+                "p50 ms", "p90 ms", "p99 ms", "max ms");
+        }
+        printf("%10.1f %10.1f %10.1f %10.1f %8u %8.2f %8.2f %8.2f %8.2f\n",
+            (now.produced - prev.produced) / seconds,
+            (now.consumed - prev.consumed) / seconds,
+            (now.skipped - prev.skipped) / seconds,
+            (now.fifo_full - prev.fifo_full) / seconds,
+            (now.lock_failures - prev.lock_failures) + (now.unlock_failures - prev.unlock_failures),
+            l.p50, l.p90, l.p99, l.max);
+        fflush(stdout);
+
+        if (prometheus_file || server != INVALID_SOCKET) {
+            text_len = formatPrometheus(text, sizeof(text), &now, &l);
+            if (prometheus_file) {
+                writePrometheus(prometheus_file, text, text_len);
+            }
+        }
+        prev = now;
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+#ifndef PIPESTATS_H
+#define PIPESTATS_H
+
+/* pipestats.h - versioned pipeline statistics at the front of the shared mapping */
+
+/* The master names its mapping PIPELINE_STATS_MAPPING (formatted with
+   its process id) and puts a PipelineStats first, so interopstat can
+   map just this block read-only while both processes keep running.
+
+   Every counter has exactly one writing process.  Bumping one is a
+   plain load and store of an aligned 32-bit volatile: relaxed, with no
+   locked bus cycle, yet no update can be lost.  Readers difference
+   successive snapshots with unsigned arithmetic, so wrapping is fine.
+
+   Fields are only ever appended; readers require version to match and
+   size to cover the fields they know about. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PIPELINE_STATS_MAGIC 0x54535049    // "IPST"
+#define PIPELINE_STATS_VERSION 1
+#define PIPELINE_STATS_MAPPING "Local\\interop-%u"
+
+#define PIPELINE_MAX_BUFFERS 4
+#define PIPELINE_LATENCY_SAMPLES 256       // must be a power of two
+
+enum {
+    PIPELINE_MASTER,
+    PIPELINE_RENDERER,
+    PIPELINE_PROCESSES
+};
+
+typedef struct _PipelineStats {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int size;                     // sizeof(PipelineStats) as built by the master
+    unsigned int pid[PIPELINE_PROCESSES];
+    unsigned int render_buffer_count;
+
+    volatile unsigned int produced;        // renderer: frames published
+    volatile unsigned int fifo_full;       // renderer: frames not rendered, no free buffer
+    volatile unsigned int consumed;        // master: frames displayed for the first time
+    volatile unsigned int skipped;         // master: frames dropped unseen
+    volatile unsigned int lock_failures[PIPELINE_PROCESSES];
+    volatile unsigned int unlock_failures[PIPELINE_PROCESSES];
+
+    // Publish time of each buffer's frame, in microseconds of the
+    // system-wide clock truncated to 32 bits; differences stay exact.
+    volatile unsigned int publish_us[PIPELINE_MAX_BUFFERS];
+    // Publish-to-first-display latency of consumed frames.
+    volatile unsigned int latency_count;
+    volatile unsigned int latency_us[PIPELINE_LATENCY_SAMPLES];
+} PipelineStats;
+
+#define PIPELINE_COUNT(stats, counter) ((stats)->counter = (stats)->counter + 1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PIPESTATS_H */
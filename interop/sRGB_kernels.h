@@ -0,0 +1,164 @@
+
+/* sRGB_kernels.h - batch sRGB conversion loops, instantiated per instruction set */
+
+/* Not a normal header: sRGB_math.c includes it once per instruction
+   set, each time first defining
+
+     VEC, VECI, VMASK   W floats, W ints, and a W lane comparison mask
+     W                  lanes per vector
+     KERNEL(name)       name with an instruction set suffix
+     KERNEL_ATTR        function attributes (target selection for GCC)
+
+   and the v* operations used below, all of which it undefines again
+   at the end.  Arrays hold RGBA pixels; indices count components, and
+   alpha (every fourth component) is linear so it passes through
+   unconverted.  Each loop starts at component i, converts whole
+   vectors, and returns where it stopped so a narrower instantiation
+   can finish the tail. */
+
+// x**p for x > 0, as exp2(p*log2(x)) with minimax polynomials; the
+// relative error stays near 1e-6 for the exponents used here.
+KERNEL_ATTR static VEC KERNEL(pow)(VEC x, VEC p)
+{
+    VECI bits = vasint(x);
+    VECI e = vsubi(vsrli(bits, 23), vset1i(127));
+    VEC m = vasfloat(vori(vandi(bits, vset1i(0x007fffff)), vset1i(0x3f800000)));
+    const VMASK big = vgt(m, vset1(1.41421356f));
+    VEC t, l, y, f, r;
+    VECI n;
+    VMASK above;
+
+    // Fold the mantissa into [sqrt(1/2), sqrt(2)) to center it on 1.
+    m = vselect(big, vmul(m, vset1(0.5f)), m);
+    e = vinc_if(e, big);
+    t = vsub(m, vset1(1.0f));
+
+    // log2(1+t)/t on [sqrt(1/2)-1, sqrt(2)-1]; log2 error under 3.1e-7.
+    l = vset1(0.170634503f);
+    l = vmuladd(l, t, vset1(-0.272697927f));
+    l = vmuladd(l, t, vset1(0.297262587f));
+    l = vmuladd(l, t, vset1(-0.358961851f));
+    l = vmuladd(l, t, vset1(0.480465034f));
+    l = vmuladd(l, t, vset1(-0.721375871f));
+    l = vmuladd(l, t, vset1(1.44269973f));
+    y = vmul(vmuladd(l, t, vcvt(e)), p);
+    // Keeps discarded lanes (x <= 0) finite and in int range.
+    y = vselect(vgt(y, vset1(-126.0f)), y, vset1(-126.0f));
+    y = vselect(vgt(y, vset1(127.0f)), vset1(127.0f), y);
+
+    // Split y into floor(y) and a fraction in [0,1); truncation
+    // rounds negative y up, so step those back by one.
+    n = vcvtt(y);
+    above = vgt(vcvt(n), y);
+    n = vdec_if(n, above);
+    f = vsub(y, vcvt(n));
+
+    // 2**f on [0,1); relative error under 7.5e-8.
+    r = vset1(0.0018775767f);
+    r = vmuladd(r, f, vset1(0.00898934002f));
+    r = vmuladd(r, f, vset1(0.0558263181f));
+    r = vmuladd(r, f, vset1(0.240153617f));
+    r = vmuladd(r, f, vset1(0.693153073f));
+    r = vmuladd(r, f, vset1(0.999999925f));
+
+    // Scale by 2**n through the exponent field.
+    return vasfloat(vaddi(vasint(r), vslli(n, 23)));
+}
+
+// convertLinearColorComponentToSRGBf for W components.
+KERNEL_ATTR static VEC KERNEL(encode)(VEC cl)
+{
+    VEC linear, curved;
+
+    // Compare and select rather than min/max so NaN becomes 0.
+    cl = vselect(vgt(cl, vset1(0.0f)), cl, vset1(0.0f));
+    cl = vselect(vgt(cl, vset1(1.0f)), vset1(1.0f), cl);
+    linear = vmul(cl, vset1(12.92f));
+    // pow of 0 is garbage, but that lane takes the linear result.
+    curved = vsub(vmul(vset1(1.055f), KERNEL(pow)(cl, vset1(1.0f/2.4f))), vset1(0.055f));
+    return vselect(vgt(vset1(0.0031308f), cl), linear, curved);
+}
+
+// convertSRGBColorComponentToLinearf for W components.
+KERNEL_ATTR static VEC KERNEL(decode)(VEC cs)
+{
+    const VEC linear = vmul(cs, vset1(1.0f/12.92f));
+    const VEC base = vmul(vadd(cs, vset1(0.055f)), vset1(1.0f/1.055f));
+    const VEC curved = KERNEL(pow)(base, vset1(2.4f));
+
+    return vselect(vgt(cs, vset1(0.04045f)), curved, linear);
+}
+
+// Alpha clamped to [0,1] before scaling to a byte.
+KERNEL_ATTR static VEC KERNEL(clamp)(VEC c)
+{
+    c = vselect(vgt(c, vset1(0.0f)), c, vset1(0.0f));
+    return vselect(vgt(c, vset1(1.0f)), vset1(1.0f), c);
+}
+
+KERNEL_ATTR static size_t KERNEL(linearToSRGBf)(float *dst, const float *src, size_t i, size_t n)
+{
+    for (; i+W <= n; i+=W) {
+        const VMASK alpha = vloadmask(alpha_lanes + (i & 3));
+        const VEC c = vload(src + i);
+
+        vstore(dst + i, vselect(alpha, c, KERNEL(encode)(c)));
+    }
+    return i;
+}
+
+KERNEL_ATTR static size_t KERNEL(linearToSRGBub)(unsigned char *dst, const float *src, size_t i, size_t n)
+{
+    for (; i+W <= n; i+=W) {
+        const VMASK alpha = vloadmask(alpha_lanes + (i & 3));
+        const VEC c = vload(src + i);
+        const VEC v = vselect(alpha, KERNEL(clamp)(c), KERNEL(encode)(c));
+
+        // v is in [0,1], so truncation is the floor of rounding to
+        // nearest; convertLinearToSRGBub corrects the last bit after.
+        vstore_ub(dst + i, vcvtt(vmuladd(v, vset1(255.0f), vset1(0.5f))));
+    }
+    return i;
+}
+
+KERNEL_ATTR static size_t KERNEL(sRGBToLinearf)(float *dst, const float *src, size_t i, size_t n)
+{
+    for (; i+W <= n; i+=W) {
+        const VMASK alpha = vloadmask(alpha_lanes + (i & 3));
+        const VEC c = vload(src + i);
+
+        vstore(dst + i, vselect(alpha, c, KERNEL(decode)(c)));
+    }
+    return i;
+}
+
+#undef VEC
+#undef VECI
+#undef VMASK
+#undef W
+#undef KERNEL
+#undef KERNEL_ATTR
+#undef vset1
+#undef vset1i
+#undef vadd
+#undef vsub
+#undef vmul
+#undef vmuladd
+#undef vgt
+#undef vselect
+#undef vasint
+#undef vasfloat
+#undef vsrli
+#undef vslli
+#undef vaddi
+#undef vsubi
+#undef vandi
+#undef vori
+#undef vcvt
+#undef vcvtt
+#undef vinc_if
+#undef vdec_if
+#undef vloadmask
+#undef vload
+#undef vstore
+#undef vstore_ub
@@ -6,9 +6,7 @@
 #include <math.h>
 
 #include "sRGB_math.h"
-
-#define FLOAT_TO_UB(_f) \
-        (unsigned char)(floorf((_f) * 255.0f + 0.5f))
+#include "sRGB_tables.h"
 
 float convertLinearColorComponentToSRGBf(const float cl)
 {
@@ -20,7 +18,7 @@ float convertLinearColorComponentToSRGBf(const float cl)
         if (cl < 0.0031308f) {
             csf = 12.92f * cl;
         } else {
-            csf = 1.055f * (float)pow(cl, 0.41666f) - 0.055f;
+            csf = 1.055f * (float)pow(cl, 1.0/2.4) - 0.055f;
         }
     } else {
         /* IEEE NaN should get here since comparisons with NaN always
@@ -30,27 +28,22 @@ float convertLinearColorComponentToSRGBf(const float cl)
     return csf;
 }
 
+/* The byte is the number of thresholds at or below cl, found by a
+   branch free binary search; no comparison with NaN succeeds, so NaN
+   gives 0. */
 unsigned char convertLinearColorComponentToSRGBub(const float cl)
 {
-    unsigned char cs;
-
-    if (cl > 1.0f) {
-        cs = 255;
-    } else if (cl > 0.0f) {
-        float csf;
+    int cs = 0;
 
-        if (cl < 0.0031308f) {
-            csf = 12.92f * cl;
-        } else {
-            csf = 1.055f * (float)pow(cl, 0.41666f) - 0.055f;
-        }
-        cs = FLOAT_TO_UB(csf);
-    } else {
-        /* IEEE NaN should get here since comparisons with NaN always
-           fail. */
-        cs = 0;
-    }
-    return cs;
+    cs += cl >= sRGB_encode_threshold[cs + 128] ? 128 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 64] ? 64 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 32] ? 32 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 16] ? 16 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 8] ? 8 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 4] ? 4 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 2] ? 2 : 0;
+    cs += cl >= sRGB_encode_threshold[cs + 1] ? 1 : 0;
+    return (unsigned char)cs;
 }
 
 float convertSRGBColorComponentToLinearf(const float cs)
@@ -64,3 +57,372 @@ float convertSRGBColorComponentToLinearf(const float cs)
     }
     return cl;
 }
+
+float convertSRGBColorComponentUBToLinearf(const unsigned char cs)
+{
+    return sRGB_decode_table[cs];
+}
+
+/* Batch conversion of RGBA arrays.  The loops live in sRGB_kernels.h,
+   instantiated below for each instruction set this compiler can
+   target; AVX2 is chosen at run time when the CPU supports it. */
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SRGB_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#define SRGB_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>  /* for __cpuid and _xgetbv */
+#endif
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64)
+#define SRGB_NEON
+#include <arm_neon.h>
+#endif
+
+typedef enum {
+    SRGB_SCALAR_CODE,
+    SRGB_SSE2_CODE,
+    SRGB_AVX2_CODE,
+    SRGB_NEON_CODE
+} SRGBcode;
+
+/* All ones in the alpha lanes of one or two RGBA pixels. */
+static const unsigned int alpha_lanes[8] = { 0, 0, 0, ~0u, 0, 0, 0, ~0u };
+
+static int floatBits(float f)
+{
+    int i;
+    memcpy(&i, &f, sizeof(i));
+    return i;
+}
+
+static float bitsFloat(int i)
+{
+    float f;
+    memcpy(&f, &i, sizeof(f));
+    return f;
+}
+
+/* Plain C, one component at a time; also finishes every vector loop. */
+#define VEC float
+#define VECI int
+#define VMASK int
+#define W 1
+#define KERNEL(name) name##_scalar
+#define KERNEL_ATTR
+#define vset1(f) (f)
+#define vset1i(n) (n)
+#define vadd(a, b) ((a) + (b))
+#define vsub(a, b) ((a) - (b))
+#define vmul(a, b) ((a) * (b))
+#define vmuladd(a, b, c) ((a) * (b) + (c))
+#define vgt(a, b) ((a) > (b))
+#define vselect(m, a, b) ((m) ? (a) : (b))
+#define vasint(x) floatBits(x)
+#define vasfloat(i) bitsFloat(i)
+#define vsrli(i, n) ((int)((unsigned int)(i) >> (n)))
+#define vslli(i, n) ((int)((unsigned int)(i) << (n)))
+#define vaddi(a, b) ((int)((unsigned int)(a) + (unsigned int)(b)))
+#define vsubi(a, b) ((a) - (b))
+#define vandi(a, b) ((a) & (b))
+#define vori(a, b) ((a) | (b))
+#define vcvt(i) ((float)(i))
+#define vcvtt(f) ((int)(f))
+#define vinc_if(i, m) ((i) + ((m) ? 1 : 0))
+#define vdec_if(i, m) ((i) - ((m) ? 1 : 0))
+#define vloadmask(p) (*(p) != 0)
+#define vload(p) (*(p))
+#define vstore(p, v) (*(p) = (v))
+#define vstore_ub(p, q) (*(p) = (unsigned char)(q))
+#include "sRGB_kernels.h"
+
+#ifdef SRGB_SSE2
+static void storeUB_sse2(unsigned char *p, __m128i q)
+{
+    int word;
+
+    q = _mm_packs_epi32(q, q);
+    q = _mm_packus_epi16(q, q);
+    word = _mm_cvtsi128_si32(q);
+    memcpy(p, &word, sizeof(word));
+}
+
+#define VEC __m128
+#define VECI __m128i
+#define VMASK __m128
+#define W 4
+#define KERNEL(name) name##_sse2
+#define KERNEL_ATTR
+#define vset1(f) _mm_set1_ps(f)
+#define vset1i(n) _mm_set1_epi32(n)
+#define vadd(a, b) _mm_add_ps(a, b)
+#define vsub(a, b) _mm_sub_ps(a, b)
+#define vmul(a, b) _mm_mul_ps(a, b)
+#define vmuladd(a, b, c) _mm_add_ps(_mm_mul_ps(a, b), c)
+#define vgt(a, b) _mm_cmpgt_ps(a, b)
+#define vselect(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define vasint(x) _mm_castps_si128(x)
+#define vasfloat(i) _mm_castsi128_ps(i)
+#define vsrli(i, n) _mm_srli_epi32(i, n)
+#define vslli(i, n) _mm_slli_epi32(i, n)
+#define vaddi(a, b) _mm_add_epi32(a, b)
+#define vsubi(a, b) _mm_sub_epi32(a, b)
+#define vandi(a, b) _mm_and_si128(a, b)
+#define vori(a, b) _mm_or_si128(a, b)
+#define vcvt(i) _mm_cvtepi32_ps(i)
+#define vcvtt(f) _mm_cvttps_epi32(f)
+#define vinc_if(i, m) _mm_sub_epi32(i, _mm_castps_si128(m))  /* true lanes are -1 */
+#define vdec_if(i, m) _mm_add_epi32(i, _mm_castps_si128(m))
+#define vloadmask(p) _mm_loadu_ps((const float*)(p))
+#define vload(p) _mm_loadu_ps(p)
+#define vstore(p, v) _mm_storeu_ps(p, v)
+#define vstore_ub(p, q) storeUB_sse2(p, q)
+#include "sRGB_kernels.h"
+#endif
+
+#ifdef SRGB_AVX2
+#ifdef __GNUC__
+#define AVX2_ATTR __attribute__((target("avx2,fma")))
+#else
+#define AVX2_ATTR
+#endif
+
+AVX2_ATTR static void storeUB_avx2(unsigned char *p, __m256i q)
+{
+    __m128i v = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+
+    _mm_storel_epi64((__m128i*)p, _mm_packus_epi16(v, v));
+}
+
+#define VEC __m256
+#define VECI __m256i
+#define VMASK __m256
+#define W 8
+#define KERNEL(name) name##_avx2
+#define KERNEL_ATTR AVX2_ATTR
+#define vset1(f) _mm256_set1_ps(f)
+#define vset1i(n) _mm256_set1_epi32(n)
+#define vadd(a, b) _mm256_add_ps(a, b)
+#define vsub(a, b) _mm256_sub_ps(a, b)
+#define vmul(a, b) _mm256_mul_ps(a, b)
+#define vmuladd(a, b, c) _mm256_fmadd_ps(a, b, c)
+#define vgt(a, b) _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define vselect(m, a, b) _mm256_blendv_ps(b, a, m)
+#define vasint(x) _mm256_castps_si256(x)
+#define vasfloat(i) _mm256_castsi256_ps(i)
+#define vsrli(i, n) _mm256_srli_epi32(i, n)
+#define vslli(i, n) _mm256_slli_epi32(i, n)
+#define vaddi(a, b) _mm256_add_epi32(a, b)
+#define vsubi(a, b) _mm256_sub_epi32(a, b)
+#define vandi(a, b) _mm256_and_si256(a, b)
+#define vori(a, b) _mm256_or_si256(a, b)
+#define vcvt(i) _mm256_cvtepi32_ps(i)
+#define vcvtt(f) _mm256_cvttps_epi32(f)
+#define vinc_if(i, m) _mm256_sub_epi32(i, _mm256_castps_si256(m))
+#define vdec_if(i, m) _mm256_add_epi32(i, _mm256_castps_si256(m))
+#define vloadmask(p) _mm256_loadu_ps((const float*)(p))
+#define vload(p) _mm256_loadu_ps(p)
+#define vstore(p, v) _mm256_storeu_ps(p, v)
+#define vstore_ub(p, q) storeUB_avx2(p, q)
+#include "sRGB_kernels.h"
+
+static int cpuHasAVX2(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return 0;
+    }
+    __cpuid(info, 1);
+    /* FMA, OSXSAVE, and AVX, and the OS saves YMM state */
+    if ((info[2] & 0x18001000) != 0x18001000 || (_xgetbv(0) & 6) != 6) {
+        return 0;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] >> 5) & 1;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+#endif
+
+#ifdef SRGB_NEON
+static void storeUB_neon(unsigned char *p, int32x4_t q)
+{
+    const uint16x4_t h = vqmovun_s32(q);
+    const uint8x8_t b = vqmovn_u16(vcombine_u16(h, h));
+    const uint32_t word = vget_lane_u32(vreinterpret_u32_u8(b), 0);
+
+    memcpy(p, &word, sizeof(word));
+}
+
+#define VEC float32x4_t
+#define VECI int32x4_t
+#define VMASK uint32x4_t
+#define W 4
+#define KERNEL(name) name##_neon
+#define KERNEL_ATTR
+#define vset1(f) vdupq_n_f32(f)
+#define vset1i(n) vdupq_n_s32(n)
+#define vadd(a, b) vaddq_f32(a, b)
+#define vsub(a, b) vsubq_f32(a, b)
+#define vmul(a, b) vmulq_f32(a, b)
+#define vmuladd(a, b, c) vmlaq_f32(c, a, b)
+#define vgt(a, b) vcgtq_f32(a, b)
+#define vselect(m, a, b) vbslq_f32(m, a, b)
+#define vasint(x) vreinterpretq_s32_f32(x)
+#define vasfloat(i) vreinterpretq_f32_s32(i)
+#define vsrli(i, n) vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(i), n))
+#define vslli(i, n) vshlq_n_s32(i, n)
+#define vaddi(a, b) vaddq_s32(a, b)
+#define vsubi(a, b) vsubq_s32(a, b)
+#define vandi(a, b) vandq_s32(a, b)
+#define vori(a, b) vorrq_s32(a, b)
+#define vcvt(i) vcvtq_f32_s32(i)
+#define vcvtt(f) vcvtq_s32_f32(f)
+#define vinc_if(i, m) vsubq_s32(i, vreinterpretq_s32_u32(m))
+#define vdec_if(i, m) vaddq_s32(i, vreinterpretq_s32_u32(m))
+#define vloadmask(p) vld1q_u32(p)
+#define vload(p) vld1q_f32(p)
+#define vstore(p, v) vst1q_f32(p, v)
+#define vstore_ub(p, q) storeUB_neon(p, q)
+#include "sRGB_kernels.h"
+#endif
+
+static int batch_code = -1;
+
+static SRGBcode batchCode(void)
+{
+    if (batch_code < 0) {
+#if defined(SRGB_AVX2)
+        batch_code = cpuHasAVX2() ? SRGB_AVX2_CODE : SRGB_SSE2_CODE;
+#elif defined(SRGB_SSE2)
+        batch_code = SRGB_SSE2_CODE;
+#elif defined(SRGB_NEON)
+        batch_code = SRGB_NEON_CODE;
+#else
+        batch_code = SRGB_SCALAR_CODE;
+#endif
+    }
+    return (SRGBcode)batch_code;
+}
+
+static const char *batch_code_name[] = { "scalar", "SSE2", "AVX2", "NEON" };
+
+const char *sRGBBatchInstructionSet(void)
+{
+    return batch_code_name[batchCode()];
+}
+
+int selectSRGBBatchInstructionSet(const char *name)
+{
+    int code;
+
+    for (code=SRGB_SCALAR_CODE; code<=SRGB_NEON_CODE; code++) {
+        if (!strcmp(name, batch_code_name[code])) {
+            break;
+        }
+    }
+    switch (code) {
+    case SRGB_SCALAR_CODE:
+        break;
+#ifdef SRGB_SSE2
+    case SRGB_SSE2_CODE:
+        break;
+#endif
+#ifdef SRGB_AVX2
+    case SRGB_AVX2_CODE:
+        if (!cpuHasAVX2()) {
+            return 0;
+        }
+        break;
+#endif
+#ifdef SRGB_NEON
+    case SRGB_NEON_CODE:
+        break;
+#endif
+    default:
+        return 0;
+    }
+    batch_code = code;
+    return 1;
+}
+
+/* Each wider loop leaves its tail to the next narrower one. */
+#if defined(SRGB_AVX2)
+#define DISPATCH(kernel, dst, src, n) \
+    switch (batchCode()) { \
+    case SRGB_AVX2_CODE: i = kernel##_avx2(dst, src, i, n); /* fall through */ \
+    case SRGB_SSE2_CODE: i = kernel##_sse2(dst, src, i, n); /* fall through */ \
+    default: kernel##_scalar(dst, src, i, n); \
+    }
+#elif defined(SRGB_SSE2)
+#define DISPATCH(kernel, dst, src, n) \
+    if (batchCode() == SRGB_SSE2_CODE) { \
+        i = kernel##_sse2(dst, src, i, n); \
+    } \
+    kernel##_scalar(dst, src, i, n);
+#elif defined(SRGB_NEON)
+#define DISPATCH(kernel, dst, src, n) \
+    if (batchCode() == SRGB_NEON_CODE) { \
+        i = kernel##_neon(dst, src, i, n); \
+    } \
+    kernel##_scalar(dst, src, i, n);
+#else
+#define DISPATCH(kernel, dst, src, n) \
+    kernel##_scalar(dst, src, i, n);
+#endif
+
+void convertLinearToSRGBf(float *dst, const float *src, size_t pixels)
+{
+    size_t i = 0;
+    DISPATCH(linearToSRGBf, dst, src, 4*pixels)
+}
+
+void convertLinearToSRGBub(unsigned char *dst, const float *src, size_t pixels)
+{
+    const size_t n = 4*pixels;
+    size_t i = 0;
+
+    DISPATCH(linearToSRGBub, dst, src, n)
+    /* The approximate pow leaves color bytes at most one off, so one
+       threshold comparison each way makes them exact. */
+    for (i=0; i<n; i++) {
+        if ((i & 3) != 3) {
+            const int cs = dst[i];
+
+            if (cs < 255 && src[i] >= sRGB_encode_threshold[cs + 1]) {
+                dst[i] = (unsigned char)(cs + 1);
+            } else if (cs > 0 && !(src[i] >= sRGB_encode_threshold[cs])) {
+                dst[i] = (unsigned char)(cs - 1);
+            }
+        }
+    }
+}
+
+void convertSRGBToLinearf(float *dst, const float *src, size_t pixels)
+{
+    size_t i = 0;
+    DISPATCH(sRGBToLinearf, dst, src, 4*pixels)
+}
+
+void convertSRGBubToLinearf(float *dst, const unsigned char *src, size_t pixels)
+{
+    const size_t n = 4*pixels;
+    size_t i;
+
+    for (i=0; i<n; i+=4) {
+        dst[i+0] = sRGB_decode_table[src[i+0]];
+        dst[i+1] = sRGB_decode_table[src[i+1]];
+        dst[i+2] = sRGB_decode_table[src[i+2]];
+        dst[i+3] = src[i+3] * (1.0f/255.0f);
+    }
+}
@@ -1,6 +1,8 @@
 
 // sRGB.c - sRGB color space conversion utilities
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -8,6 +10,27 @@ extern "C" {
 extern float convertLinearColorComponentToSRGBf(const float cl);
 extern unsigned char convertLinearColorComponentToSRGBub(const float cl);
 extern float convertSRGBColorComponentToLinearf(const float cs);
+/* Exact: the correctly rounded float of the sRGB decoding. */
+extern float convertSRGBColorComponentUBToLinearf(const unsigned char cs);
+
+/* convertLinearColorComponentToSRGBub and the unsigned byte forms
+   below use tables from sRGB_tables.h and are exact: the byte is the
+   exact encoding rounded to nearest, and bytes decode to the correctly
+   rounded float. */
+
+/* Whole arrays of RGBA pixels, vectorized with SSE2, AVX2, or NEON
+   where available.  Float color components match the functions above
+   to within 2e-6 relative; alpha is copied, or clamped and scaled for
+   unsigned bytes.  The float to float forms may convert in place. */
+extern void convertLinearToSRGBf(float *dst, const float *src, size_t pixels);
+extern void convertLinearToSRGBub(unsigned char *dst, const float *src, size_t pixels);
+extern void convertSRGBToLinearf(float *dst, const float *src, size_t pixels);
+extern void convertSRGBubToLinearf(float *dst, const unsigned char *src, size_t pixels);
+/* "AVX2", "SSE2", "NEON", or "scalar" */
+extern const char *sRGBBatchInstructionSet(void);
+/* Makes the batch forms use the named instruction set, for testing
+   each one; returns zero, changing nothing, if it is unavailable. */
+extern int selectSRGBBatchInstructionSet(const char *name);
 
 #ifdef __cplusplus
 }
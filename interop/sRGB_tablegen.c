@@ -0,0 +1,72 @@
+
+/* sRGB_tablegen.c - generate sRGB_tables.h */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+// Run "make -f GNUmakefile srgb_tables" (or compile this and redirect
+// its output to sRGB_tables.h) after changing the conversion.  Values
+// come from the sRGB formulas evaluated in double precision with the
+// exact exponent 2.4, then rounded once to float, so each table entry
+// is the correctly rounded float.
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static double decode(double cs)
+{
+    if (cs <= 0.04045) {
+        return cs / 12.92;
+    }
+    return pow((cs + 0.055) / 1.055, 2.4);
+}
+
+// Smallest float not less than x.
+static float floatCeiling(double x)
+{
+    float f = (float)x;
+
+    if ((double)f < x) {
+        f = nextafterf(f, 2.0f);
+    }
+    return f;
+}
+
+// Prints entry i of a table as a float literal that reads back as f.
+static void printEntry(int i, float f)
+{
+    char text[32];
+
+    sprintf(text, "%.9g", f);
+    if (!strpbrk(text, ".e")) {
+        strcat(text, ".0");
+    }
+    printf("%s%sf,%s", i % 6 ? " " : "    ", text, i % 6 == 5 || i == 255 ? "\n" : "");
+}
+
+int main(void)
+{
+    int i;
+
+    printf("/* sRGB_tables.h - generated by sRGB_tablegen.c; do not edit */\n\n");
+
+    printf("/* Linear value of each sRGB byte, correctly rounded to float. */\n");
+    printf("static const float sRGB_decode_table[256] = {\n");
+    for (i=0; i<256; i++) {
+        printEntry(i, (float)decode(i / 255.0));
+    }
+    printf("};\n\n");
+
+    // The byte floor(255*cs + 0.5) of the exact encoding cs reaches k
+    // once cs reaches (k-0.5)/255, that is, once the linear value
+    // reaches the decoding of that.
+    printf("/* Smallest float whose correctly rounded sRGB byte is k, for k in\n");
+    printf("   1..255; the byte for x is how many of these are <= x.  Entry 0\n");
+    printf("   is never read. */\n");
+    printf("static const float sRGB_encode_threshold[256] = {\n");
+    for (i=0; i<256; i++) {
+        printEntry(i, i ? floatCeiling(decode((i - 0.5) / 255.0)) : 0.0f);
+    }
+    printf("};\n");
+    return 0;
+}
@@ -7,10 +7,6 @@
 
 #include <GL/glew.h>
 
-#ifdef _WIN32
-#include <windows.h>  /* for QueryPerformanceCounter */
-#endif
-
 #if __APPLE__
 #include <GLUT/glut.h>
 #else
@@ -25,13 +21,6 @@
 // Enough characters for strings "fps" or "ms" and "--" and all decimal numbers
 #include "fps_text_image.h"
 
-static int reportFPS = 1;
-static int displayMS = 0;
-static GLfloat textColor[3] = { 1,1,0 };  // yellow
-static int validFPS = 0;
-static float scale = 1.0;
-static FPSorigin origin = FPS_LOWER_RIGHT;
-
 int highlight = 0;  // enable for better contrast with the background
 
 void initFPScontext(FPScontext *ctx, FPSusage usage)
@@ -41,6 +30,14 @@ void initFPScontext(FPScontext *ctx, FPSusage usage)
     ctx->height = 0;
     ctx->count = 0;
     ctx->last_fpsRate = -666;  // bogus
+    ctx->report = 1;
+    ctx->display_ms = 0;
+    ctx->text_color[0] = 1;  // yellow
+    ctx->text_color[1] = 1;
+    ctx->text_color[2] = 0;
+    ctx->scale = 1.0;
+    ctx->origin = FPS_LOWER_RIGHT;
+    initFPScounter(&ctx->counter);
     ctx->fps_text_texture = 0;
     if (usage == FPS_USAGE_TEXTURE) {
         glGenTextures(1, &ctx->fps_text_texture);
@@ -76,8 +73,9 @@ static const float advance = adv/256.0f;
 static void computeLocation(FPScontext *ctx, float *x, float *y)
 {
     const int w = ctx->width, h = ctx->height;
+    const float scale = ctx->scale;
 
-    switch (origin) {
+    switch (ctx->origin) {
     case FPS_LOWER_RIGHT:
         *x = w-10*adv*scale;
         *y = 15;
@@ -102,6 +100,7 @@ static void computeLocation(FPScontext *ctx, float *x, float *y)
 
 static void drawTexturedFPS(FPScontext *ctx, double fpsRate)
 {
+    const float scale = ctx->scale;
 #ifndef NDEBUG
     GLenum got_error;
 
@@ -144,7 +143,7 @@ static void drawTexturedFPS(FPScontext *ctx, double fpsRate)
             assert(glIsTexture(ctx->fps_text_texture));
             glBindTexture(GL_TEXTURE_2D, ctx->fps_text_texture);
             glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-            glColor3fv(textColor);
+            glColor3fv(ctx->text_color);
             glDisable(GL_BLEND);
             glDisable(GL_STENCIL_TEST);
             glEnable(GL_ALPHA_TEST);
@@ -163,7 +162,7 @@ static void drawTexturedFPS(FPScontext *ctx, double fpsRate)
                 computeLocation(ctx, &x, &y);
 
                 // Construct "ms" or "fps" quadrilaterals
-                if (displayMS) {
+                if (ctx->display_ms) {
                     // Milliseconds reports "ms"
                     const int m_ndx = 15;
                     const int s_ndx = 13;
@@ -205,14 +204,14 @@ static void drawTexturedFPS(FPScontext *ctx, double fpsRate)
                 }
 
                 // Is the frames/second measurement valid?
-                if (fpsRate > 0 || !validFPS) { 
+                if (fpsRate > 0 || !ctx->counter.valid) { 
                     // Yes, construct the string for it.
                     const char *c;
 
 #ifdef _WIN32
 #define snprintf _snprintf
 #endif
-                    double value = displayMS ? 1000.0/fpsRate : fpsRate;
+                    double value = ctx->display_ms ? 1000.0/fpsRate : fpsRate;
                     // Is the frames/second fast, meaning more than 10 fps?
                     if (value > 10) {
                         // Yes, show less decimal precsion.
@@ -289,12 +288,12 @@ static void drawTexturedFPS(FPScontext *ctx, double fpsRate)
 #define snprintf _snprintf
 #endif
 
-static void setBitmapOrigin(int offset)
+static void setBitmapOrigin(FPScontext *ctx, int offset)
 {
     GLubyte dummy;
     GLfloat x, y;
 
-    switch (origin) {
+    switch (ctx->origin) {
     case FPS_LOWER_RIGHT:
         glRasterPos2f(1,1);
         x = -10*9;
@@ -321,7 +320,7 @@ static void setBitmapOrigin(int offset)
     glBitmap(0, 0, 0, 0, x+offset, y+offset, &dummy);
 }
 
-static void drawBitmapFPS(double fpsRate)
+static void drawBitmapFPS(FPScontext *ctx, double fpsRate)
 {
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix(); {
@@ -333,8 +332,8 @@ static void drawBitmapFPS(double fpsRate)
             glLoadIdentity();
             glOrtho(0, 1, 1, 0, -1, 1);
             //glDisable(GL_DEPTH_TEST);
-            if (displayMS) {
-                if (fpsRate > 0 || !validFPS) {
+            if (ctx->display_ms) {
+                if (fpsRate > 0 || !ctx->counter.valid) {
                     double milliseconds = 1000.0/fpsRate;
                     // Is the frames/second slow, meaning less than 1 fps?
                     if (milliseconds < 1) {
@@ -350,7 +349,7 @@ static void drawBitmapFPS(double fpsRate)
                     strcpy(buffer, "ms --");
                 }
             } else {
-                if (fpsRate > 0 || !validFPS) {
+                if (fpsRate > 0 || !ctx->counter.valid) {
                     // Is the frames/second slow, meaning less than 1 fps?
                     if (fpsRate < 1) {
                         // Yes, show more decimal precision?
@@ -367,7 +366,7 @@ static void drawBitmapFPS(double fpsRate)
             }
             if (highlight) {
                 int i;
-                GLfloat altColor[3] = { textColor[0]-0.66f, textColor[1]-0.66f, textColor[2]-0.66 };
+                GLfloat altColor[3] = { ctx->text_color[0]-0.66f, ctx->text_color[1]-0.66f, ctx->text_color[2]-0.66 };
                 for (i = 0; i<3; i++) {
                     if (altColor[i] < 0) {
                         altColor[i] = 1;
@@ -376,14 +375,14 @@ static void drawBitmapFPS(double fpsRate)
                 glColor3fv(altColor);
                 // Draw text shifted lower-left by a pixel and upper-right by a pixel.
                 for (i=-1; i<=1; i+=2) {
-                    setBitmapOrigin(i);
+                    setBitmapOrigin(ctx, i);
                     for (c = buffer; *c != '\0'; c++) {
                         glutBitmapCharacter(GLUT_BITMAP_9_BY_15, *c);
                     }
                 }
             }
-            glColor3fv(textColor);
-            setBitmapOrigin(0);
+            glColor3fv(ctx->text_color);
+            setBitmapOrigin(ctx, 0);
             for (c = buffer; *c != '\0'; c++) {
                 glutBitmapCharacter(GLUT_BITMAP_9_BY_15, *c);
             }
@@ -437,175 +436,418 @@ static void drawFPS(FPScontext *ctx, double fpsRate)
     if (ctx->usage == FPS_USAGE_TEXTURE) {
         drawTexturedFPS(ctx, fpsRate);
     } else {
-        drawBitmapFPS(fpsRate);
+        drawBitmapFPS(ctx, fpsRate);
     }
 }
 
-#ifdef _WIN32
-static __int64 freq = 0;
+void pushFPSring(FPSring *ring, float interval_ms)
+{
+    ring->interval_ms[ring->count % FPS_RING_SAMPLES] = interval_ms;
+    ring->count++;
+}
+
+void initFPSgraph(FPSgraph *graph, float max_ms, int height)
+{
+    graph->ring_count = 0;
+    graph->max_ms = max_ms;
+    graph->height = height;
+}
+
+int addFPSgraphRing(FPSgraph *graph, const FPSring *ring, float r, float g, float b)
+{
+    GLubyte *color;
+
+    if (graph->ring_count >= MAX_FPS_GRAPH_RINGS) {
+        return 0;
+    }
+    graph->ring[graph->ring_count] = ring;
+    color = graph->color[graph->ring_count];
+    color[0] = (GLubyte)(r*255 + 0.5f);
+    color[1] = (GLubyte)(g*255 + 0.5f);
+    color[2] = (GLubyte)(b*255 + 0.5f);
+    color[3] = 255;
+    graph->ring_count++;
+    return 1;
+}
+
+#define graph_x 15
+#define graph_y 40
+#define graph_step 2  // pixels per sample
+
+static float graphHeight(const FPSgraph *graph, float ms)
+{
+    if (ms > graph->max_ms) {
+        ms = graph->max_ms;
+    }
+    return graph_y + ms/graph->max_ms*graph->height;
+}
+
+// Every line of the graph goes in one GL_LINES array so drawing it is
+// a single glDrawArrays however many rings are shown.
+static int buildFPSgraph(FPSgraph *graph)
+{
+    static const float budget_hz[3] = { 60, 90, 120 };
+    static const GLubyte budget_color[3][4] = {
+        { 255, 255, 255, 255 },
+        { 160, 160, 160, 255 },
+        { 96, 96, 96, 255 },
+    };
+    const float right = graph_x + (FPS_RING_SAMPLES-1)*graph_step;
+    FPSgraphVertex *v = graph->varray;
+    int i, r, k;
+
+#define vertex(X,Y,C) v->x = X, v->y = Y, memcpy(v->color, C, 4), v++
+
+    for (i=0; i<3; i++) {
+        const float y = graphHeight(graph, 1000/budget_hz[i]);
+
+        vertex(graph_x, y, budget_color[i]);
+        vertex(right, y, budget_color[i]);
+    }
+    for (r=0; r<graph->ring_count; r++) {
+        const FPSring *ring = graph->ring[r];
+        // Snapshot the count; a writer in another process may advance it.
+        const unsigned int count = ring->count;
+        const unsigned int samples = count < FPS_RING_SAMPLES ? count : FPS_RING_SAMPLES;
+        float x = right;
+        float y;
+
+        if (samples < 2) {
+            continue;
+        }
+        // Walk from the newest sample leftward.
+        y = graphHeight(graph, ring->interval_ms[(count-1) % FPS_RING_SAMPLES]);
+        for (k=1; k<(int)samples; k++) {
+            const float older_y = graphHeight(graph, ring->interval_ms[(count-1-k) % FPS_RING_SAMPLES]);
+
+            vertex(x, y, graph->color[r]);
+            vertex(x-graph_step, older_y, graph->color[r]);
+            x -= graph_step;
+            y = older_y;
+        }
+    }
+#undef vertex
+    assert(v - graph->varray <= MAX_FPS_GRAPH_VERTICES);
+    return (int)(v - graph->varray);
+}
+
+void drawFPSgraph(FPScontext *ctx, FPSgraph *graph)
+{
+    const int count = buildFPSgraph(graph);
+
+    assert(!glIsEnabled(GL_DEPTH_TEST));
+    assert(!glIsEnabled(GL_TEXTURE_2D));
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix(); {
+        glLoadIdentity();
+        glMatrixMode(GL_PROJECTION);
+        glPushMatrix(); {
+            const int w = ctx->width, h = ctx->height;
+
+            assert(w > 0);
+            assert(h > 0);
+            glLoadIdentity();
+            glOrtho(0, w, 0, h, -1, 1);
+            glDisable(GL_BLEND);
+            glDisable(GL_STENCIL_TEST);
+
+            assert(glIsEnabled(GL_VERTEX_ARRAY));
+            glEnableClientState(GL_COLOR_ARRAY);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);  // source client-memory arrays
+            glVertexPointer(2, GL_FLOAT, sizeof(FPSgraphVertex), &graph->varray[0].x);
+            glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(FPSgraphVertex), graph->varray[0].color);
+            glDrawArrays(GL_LINES, 0, count);
+            glDisableClientState(GL_COLOR_ARRAY);
+            assert(glGetError() == GL_NO_ERROR);
+        } glPopMatrix();
+        glMatrixMode(GL_MODELVIEW);
+    } glPopMatrix();
+}
+
+#define SUB_BUCKETS (1 << FPS_HISTOGRAM_SUB_BUCKET_BITS)
+#define UNIT_SHIFT 10  // histogram unit is 1024 ns
+
+#if defined(__GNUC__)
+#define highestBit(v) (31 - __builtin_clz(v))
+#elif defined(_MSC_VER)
+#include <intrin.h>
+static int highestBit(unsigned int v)
+{
+    unsigned long i;
+    _BitScanReverse(&i, v);
+    return (int) i;
+}
 #else
-#include <sys/time.h> /* for gettimeofday and struct timeval */
+static int highestBit(unsigned int v)
+{
+    int i = 0;
+    while (v >>= 1) {
+        i++;
+    }
+    return i;
+}
 #endif
 
-double getElapsedTime()
+static int bucketIndex(GLUTnanoseconds interval)
 {
-  static int firstTime = 1;
-  double secs;
-#ifdef _WIN32
-  /* Use Win32 performance counter for high-accuracy timing. */
-  static __int64 startTime = 0;  /* Timer count for last fps update */
-  __int64 newCount;
+    const GLUTnanoseconds units = interval >> UNIT_SHIFT;
+    unsigned int v;
+    int msb;
 
-  if (!freq) {
-    QueryPerformanceFrequency((LARGE_INTEGER*) &freq);
-  }
+    if (units >= (1u << FPS_HISTOGRAM_MAX_BITS)) {
+        v = (1u << FPS_HISTOGRAM_MAX_BITS) - 1;
+    } else {
+        v = (unsigned int) units;
+    }
+    if (v < SUB_BUCKETS) {
+        return v;
+    }
+    // Top FPS_HISTOGRAM_SUB_BUCKET_BITS+1 bits of v pick the bucket.
+    msb = highestBit(v);
+    return ((msb - FPS_HISTOGRAM_SUB_BUCKET_BITS + 1) << FPS_HISTOGRAM_SUB_BUCKET_BITS)
+         + (v >> (msb - FPS_HISTOGRAM_SUB_BUCKET_BITS)) - SUB_BUCKETS;
+}
 
-  /* Update the frames per second count if we have gone past at least
-     a second since the last update. */
+// Largest interval (in nanoseconds) that lands in the bucket.
+static GLUTnanoseconds bucketLimit(int index)
+{
+    const int magnitude = index >> FPS_HISTOGRAM_SUB_BUCKET_BITS;
+    const int sub = index & (SUB_BUCKETS-1);
+    GLUTnanoseconds units;
 
-  QueryPerformanceCounter((LARGE_INTEGER*) &newCount);
-  if (firstTime) {
-    startTime = newCount;
-    firstTime = 0;
-  }
-  secs = (double) (newCount - startTime) / (double)freq;
-#else
-  /* Use BSD 4.2 gettimeofday system call for high-accuracy timing. */
-  static struct timeval start_tp;
-  struct timeval new_tp;
-  
-  gettimeofday(&new_tp, NULL);
+    if (magnitude == 0) {
+        units = sub + 1;
+    } else {
+        units = (GLUTnanoseconds) (SUB_BUCKETS + sub + 1) << (magnitude - 1);
+    }
+    return (units << UNIT_SHIFT) - 1;
+}
+
+void resetFPShistogram(FPShistogram *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+void recordFPShistogram(FPShistogram *h, GLUTnanoseconds interval, GLUTnanoseconds budget)
+{
+    h->bucket[bucketIndex(interval)]++;
+    h->frames++;
+    if (interval > budget) {
+        h->over_budget++;
+    }
+    if (interval > h->max) {
+        h->max = interval;
+    }
+}
+
+// Returns milliseconds at or below which percentile% of frames fell.
+double percentileFPShistogram(const FPShistogram *h, double percentile)
+{
+    const double wanted = percentile/100.0 * h->frames;
+    unsigned int seen = 0;
+    int i;
+
+    if (h->frames == 0) {
+        return 0;
+    }
+    for (i=0; i<FPS_HISTOGRAM_BUCKETS; i++) {
+        seen += h->bucket[i];
+        if (seen > 0 && seen >= wanted) {
+            GLUTnanoseconds limit = bucketLimit(i);
+
+            // The largest frame is known exactly; never report past it,
+            // and report it for the clamped last bucket.
+            if (limit > h->max || i == FPS_HISTOGRAM_BUCKETS-1) {
+                limit = h->max;
+            }
+            return limit / 1e6;
+        }
+    }
+    return h->max / 1e6;
+}
+
+void summarizeFPShistogram(const FPShistogram *h, FPSstats *stats)
+{
+    stats->frames = h->frames;
+    stats->over_budget = h->over_budget;
+    stats->p50 = percentileFPShistogram(h, 50);
+    stats->p90 = percentileFPShistogram(h, 90);
+    stats->p99 = percentileFPShistogram(h, 99);
+    stats->p999 = percentileFPShistogram(h, 99.9);
+    stats->max = h->max / 1e6;
+}
+
+/* Both timers read GLUT's monotonic nanosecond clock so stepping the
+   wall clock cannot produce a bogus frame rate. */
+
+double getElapsedTime()
+{
+  static int firstTime = 1;
+  static GLUTnanoseconds startTime;
+  GLUTnanoseconds now;
+
+  now = glutGetNanoseconds();
   if (firstTime) {
-    start_tp.tv_sec = new_tp.tv_sec;
-    start_tp.tv_usec = new_tp.tv_usec;
+    startTime = now;
     firstTime = 0;
   }
-  secs = (new_tp.tv_sec - start_tp.tv_sec) + (new_tp.tv_usec - start_tp.tv_usec)/1000000.0;
-#endif
-  return secs;
+  return (now - startTime) / 1e9;
 }
 
-static double lastFpsRate = 0;
-static int frameCount = 0;     /* Number of frames for timing */
-#ifdef _WIN32
-/* Use Win32 performance counter for high-accuracy timing. */
-static __int64 lastCount = 0;  /* Timer count for last fps update */
-#else
-static struct timeval last_tp = { 0, 0 };
-#endif
+void initFPScounter(FPScounter *counter)
+{
+    counter->valid = 0;
+    counter->frame_count = 0;
+    counter->last_rate = 0;
+    counter->last_time = 0;
+    counter->last_frame = 0;
+    counter->budget = 16666667;  // 60 Hz
+    counter->window_length = 10000000000ull;
+    counter->window_start = 0;
+    resetFPShistogram(&counter->window);
+    resetFPShistogram(&counter->last_window);
+    resetFPShistogram(&counter->total);
+    counter->ring = NULL;
+}
 
-void invalidateFPS()
+void setFPSbudget(FPScounter *counter, double ms)
 {
-    validFPS = 0;
+    counter->budget = (GLUTnanoseconds) (ms * 1e6);
 }
 
-void restartFPS()
+void setFPSwindow(FPScounter *counter, double seconds)
 {
-    frameCount = 0;
-    validFPS = 1;
-    lastFpsRate = -1;
-#ifdef _WIN32
-    QueryPerformanceCounter((LARGE_INTEGER*) &lastCount);
-#else
-    gettimeofday(&last_tp, NULL);
-#endif
+    counter->window_length = (GLUTnanoseconds) (seconds * 1e9);
 }
 
-double just_handleFPS(void)
+void resetFPSstats(FPScounter *counter)
 {
-#ifdef _WIN32
-  /* Use Win32 performance counter for high-accuracy timing. */
-  __int64 newCount;
+    resetFPShistogram(&counter->window);
+    resetFPShistogram(&counter->last_window);
+    resetFPShistogram(&counter->total);
+    counter->window_start = glutGetNanoseconds();
+}
 
-  if (!freq) {
-    QueryPerformanceFrequency((LARGE_INTEGER*) &freq);
-  }
+void getFPSstats(const FPScounter *counter, FPSstats *window, FPSstats *total)
+{
+    if (window) {
+        // Until a window completes, report the partial one.
+        summarizeFPShistogram(counter->last_window.frames ?
+            &counter->last_window : &counter->window, window);
+    }
+    if (total) {
+        summarizeFPShistogram(&counter->total, total);
+    }
+}
 
-  /* Update the frames per second count if we have gone past at least
-     a second since the last update. */
+static void recordFrameInterval(FPScounter *counter, GLUTnanoseconds now)
+{
+    const GLUTnanoseconds interval = now - counter->last_frame;
 
-  QueryPerformanceCounter((LARGE_INTEGER*) &newCount);
-  frameCount++;
-  if ((newCount - lastCount) > freq) {
-    double fpsRate;
+    recordFPShistogram(&counter->window, interval, counter->budget);
+    recordFPShistogram(&counter->total, interval, counter->budget);
+    if (counter->ring) {
+        pushFPSring(counter->ring, (float) (interval / 1e6));
+    }
+    if (now - counter->window_start >= counter->window_length) {
+        counter->last_window = counter->window;
+        resetFPShistogram(&counter->window);
+        counter->window_start = now;
+    }
+}
+
+void invalidateFPS(FPScounter *counter)
+{
+    counter->valid = 0;
+}
+
+static void restartFPS(FPScounter *counter)
+{
+    counter->frame_count = 0;
+    counter->valid = 1;
+    counter->last_rate = -1;
+    counter->last_time = glutGetNanoseconds();
+    counter->last_frame = counter->last_time;
+}
 
-    fpsRate = (double) (freq * (__int64) frameCount)  / (double) (newCount - lastCount);
-    lastCount = newCount;
-    frameCount = 0;
-    lastFpsRate = fpsRate;
+double just_handleFPS(FPScounter *counter)
+{
+  GLUTnanoseconds now;
+
+  now = glutGetNanoseconds();
+  // An interval spanning an invalidation is not a real frame.
+  if (counter->valid) {
+    recordFrameInterval(counter, now);
   }
-#else
-  /* Use BSD 4.2 gettimeofday system call for high-accuracy timing. */
-  struct timeval new_tp;
-  double secs;
-  
-  gettimeofday(&new_tp, NULL);
-  secs = (new_tp.tv_sec - last_tp.tv_sec) + (new_tp.tv_usec - last_tp.tv_usec)/1000000.0;
-  if (secs >= 1.0) {
-    lastFpsRate = frameCount / secs;
-    last_tp = new_tp;
-    frameCount = 0;
+  counter->last_frame = now;
+
+  /* Update the frames per second count if we have gone past at least
+     a second since the last update. */
+  counter->frame_count++;
+  if (now - counter->last_time >= 1000000000) {
+    counter->last_rate = counter->frame_count * 1e9 / (double) (now - counter->last_time);
+    counter->last_time = now;
+    counter->frame_count = 0;
   }
-  frameCount++;
-#endif
-  if (!validFPS) {
-    restartFPS();
+  if (!counter->valid) {
+    restartFPS(counter);
   }
-  return lastFpsRate;
+  return counter->last_rate;
 }
 
 double handleFPS(FPScontext *ctx)
 {
-  double lastFpsRate = just_handleFPS();
-  if (reportFPS) {
+  double lastFpsRate = just_handleFPS(&ctx->counter);
+  if (ctx->report) {
     drawFPS(ctx, lastFpsRate);
   }
   return lastFpsRate;
 }
 
-void colorFPS(float r, float g, float b)
+void colorFPS(FPScontext *ctx, float r, float g, float b)
 {
-  textColor[0] = r;
-  textColor[1] = g;
-  textColor[2] = b;
+  ctx->text_color[0] = r;
+  ctx->text_color[1] = g;
+  ctx->text_color[2] = b;
 }
 
-void scaleFPS(float new_scale)
+void scaleFPS(FPScontext *ctx, float new_scale)
 {
-  scale = new_scale;
+  ctx->scale = new_scale;
 }
 
-void toggleFPS(void)
+void toggleFPS(FPScontext *ctx)
 {
-  reportFPS = !reportFPS;
+  ctx->report = !ctx->report;
 }
 
-void toggleFPSunits(void)
+void toggleFPSunits(FPScontext *ctx)
 {
-  displayMS = !displayMS;
+  ctx->display_ms = !ctx->display_ms;
 }
 
-void reportFPSinMS(void)
+void reportFPSinMS(FPScontext *ctx)
 {
-    displayMS = 1;
+    ctx->display_ms = 1;
 }
 
-void reportFPSinFPS(void)
+void reportFPSinFPS(FPScontext *ctx)
 {
-    displayMS = 0;
+    ctx->display_ms = 0;
 }
 
-void enableFPS(void)
+void enableFPS(FPScontext *ctx)
 {
-  reportFPS = 1;
+  ctx->report = 1;
 }
 
-void disableFPS(void)
+void disableFPS(FPScontext *ctx)
 {
-  reportFPS = 0;
+  ctx->report = 0;
 }
 
-void setFPSorigin(FPSorigin new_origin)
+void setFPSorigin(FPScontext *ctx, FPSorigin new_origin)
 {
-    origin = new_origin;
+    ctx->origin = new_origin;
 }
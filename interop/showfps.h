@@ -23,6 +23,77 @@ typedef enum {
     FPS_UPPER_LEFT
 } FPSorigin;
 
+/* Frame-time histogram.  Intervals are bucketed log-linearly in
+   ~1 microsecond units with 16 buckets per power of two, so memory is
+   fixed, recording is one increment, and any percentile is within
+   6.25% of the true interval.  Intervals past ~33 seconds clamp to
+   the last bucket. */
+#define FPS_HISTOGRAM_SUB_BUCKET_BITS 4
+#define FPS_HISTOGRAM_MAX_BITS 25
+#define FPS_HISTOGRAM_BUCKETS \
+    ((FPS_HISTOGRAM_MAX_BITS-FPS_HISTOGRAM_SUB_BUCKET_BITS+1) << FPS_HISTOGRAM_SUB_BUCKET_BITS)
+
+typedef struct _FPShistogram {
+    unsigned int bucket[FPS_HISTOGRAM_BUCKETS];
+    unsigned int frames;
+    unsigned int over_budget;
+    GLUTnanoseconds max;
+} FPShistogram;
+
+/* Summary of a histogram; times in milliseconds. */
+typedef struct _FPSstats {
+    unsigned int frames;
+    unsigned int over_budget;
+    double p50, p90, p99, p999;
+    double max;
+} FPSstats;
+
+/* Ring of the most recent frame intervals.  Plain data so it can live
+   in memory shared between processes; one writer, and readers
+   tolerate a sample being overwritten while they draw it. */
+#define FPS_RING_SAMPLES 256
+
+typedef struct _FPSring {
+    float interval_ms[FPS_RING_SAMPLES];
+    unsigned int count;  /* samples ever pushed; next goes at count % FPS_RING_SAMPLES */
+} FPSring;
+
+/* Frame timing for one stream of frames.  Counters share no state,
+   so each window or thread can own one. */
+typedef struct _FPScounter {
+    int valid;
+    int frame_count;              /* frames since last rate update */
+    double last_rate;
+    GLUTnanoseconds last_time;    /* time of last rate update */
+    GLUTnanoseconds last_frame;   /* time of previous frame */
+    GLUTnanoseconds budget;
+    GLUTnanoseconds window_length;
+    GLUTnanoseconds window_start;
+    FPShistogram window;          /* current rolling window */
+    FPShistogram last_window;     /* most recently completed window */
+    FPShistogram total;           /* every frame since reset */
+    FPSring *ring;                /* optional, receives each interval */
+} FPScounter;
+
+/* Scrolling graph of one or more rings, newest sample at the right,
+   with budget lines at 60, 90, and 120 Hz. */
+#define MAX_FPS_GRAPH_RINGS 4
+#define MAX_FPS_GRAPH_VERTICES (2*3 + MAX_FPS_GRAPH_RINGS*2*(FPS_RING_SAMPLES-1))
+
+typedef struct _FPSgraphVertex {
+    GLfloat x, y;
+    GLubyte color[4];
+} FPSgraphVertex;
+
+typedef struct _FPSgraph {
+    int ring_count;
+    const FPSring *ring[MAX_FPS_GRAPH_RINGS];
+    GLubyte color[MAX_FPS_GRAPH_RINGS][4];
+    float max_ms;                 /* interval at the top of the graph */
+    int height;                   /* pixels */
+    FPSgraphVertex varray[MAX_FPS_GRAPH_VERTICES];
+} FPSgraph;
+
 typedef struct _FPScontext {
     FPSusage usage;
     int width, height;
@@ -31,25 +102,53 @@ typedef struct _FPScontext {
     float last_scale;
     GLint count;
     GLfloat varray[4*MAX_FPS_QUADS];
+    int report;                   /* draw the rate in handleFPS */
+    int display_ms;               /* milliseconds per frame, not fps */
+    GLfloat text_color[3];
+    float scale;
+    FPSorigin origin;
+    FPScounter counter;
 } FPScontext;
 
+extern void resetFPShistogram(FPShistogram *h);
+extern void recordFPShistogram(FPShistogram *h, GLUTnanoseconds interval, GLUTnanoseconds budget);
+extern double percentileFPShistogram(const FPShistogram *h, double percentile);
+extern void summarizeFPShistogram(const FPShistogram *h, FPSstats *stats);
+
+extern void pushFPSring(FPSring *ring, float interval_ms);
+
+extern void initFPSgraph(FPSgraph *graph, float max_ms, int height);
+/* Returns nonzero on success, zero if the graph already has
+   MAX_FPS_GRAPH_RINGS rings. */
+extern int addFPSgraphRing(FPSgraph *graph, const FPSring *ring, float r, float g, float b);
+extern void drawFPSgraph(FPScontext *ctx, FPSgraph *graph);
+
 extern void initFPScontext(FPScontext *, FPSusage);
 extern void reshapeFPScontext(FPScontext *ctx, int w, int h);
 extern void releaseFPScontext(FPScontext *ctx);
 
-extern double just_handleFPS(void);
+extern void initFPScounter(FPScounter *counter);
+extern double just_handleFPS(FPScounter *counter);
+extern void invalidateFPS(FPScounter *counter);
 extern double handleFPS(FPScontext *);
-extern void toggleFPSunits(void);
-extern void reportFPSinMS(void);
-extern void reportFPSinFPS(void);
-extern void toggleFPS();
-extern void enableFPS();
-extern void disableFPS();
-extern void colorFPS(float r, float g, float b);
-extern void scaleFPS(float new_scale);
+extern void toggleFPSunits(FPScontext *ctx);
+extern void reportFPSinMS(FPScontext *ctx);
+extern void reportFPSinFPS(FPScontext *ctx);
+extern void toggleFPS(FPScontext *ctx);
+extern void enableFPS(FPScontext *ctx);
+extern void disableFPS(FPScontext *ctx);
+extern void colorFPS(FPScontext *ctx, float r, float g, float b);
+extern void scaleFPS(FPScontext *ctx, float new_scale);
+extern void setFPSorigin(FPScontext *ctx, FPSorigin);
 extern double getElapsedTime();
-extern void invalidateFPS();
-extern void setFPSorigin(FPSorigin);
+
+/* Statistics of the frame intervals seen by a counter.  The window
+   statistics cover the most recently completed rolling window; the
+   total statistics cover every frame since resetFPSstats. */
+extern void setFPSbudget(FPScounter *counter, double ms);
+extern void setFPSwindow(FPScounter *counter, double seconds);
+extern void resetFPSstats(FPScounter *counter);
+extern void getFPSstats(const FPScounter *counter, FPSstats *window, FPSstats *total);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,88 @@
+
+/* slotsync.c - timed lock/unlock of shared render buffers */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+#include <assert.h>
+#include <string.h>
+
+#include <GL/glew.h>
+
+#if __APPLE__
+#include <GLUT/glut.h>
+#else
+#include <GL/glut.h>
+#endif
+
+#include "showfps.h"
+#include "slotsync.h"
+#include "trace.h"
+
+void initSlotSync(SlotSync *sync, const SlotSyncBackend *backend, void *data,
+                  SlotSyncProcess process, SlotSyncStats *stats, int slot_count, int reset)
+{
+    int i;
+
+    assert(slot_count <= MAX_SLOT_SYNC_SLOTS);
+    sync->backend = backend;
+    sync->data = data;
+    sync->process = process;
+    sync->stats = stats;
+    sync->slot_count = slot_count;
+    sync->slow = 1000000;  // 1 ms
+    for (i=0; i<slot_count; i++) {
+        sync->locked_at[i] = 0;
+        if (reset) {
+            memset(&stats[i], 0, sizeof(stats[i]));
+            stats[i].holder = SLOT_SYNC_NO_HOLDER;
+        }
+    }
+}
+
+int lockSlot(SlotSync *sync, int slot)
+{
+    SlotSyncStats *stats = &sync->stats[slot];
+    const unsigned int holder = stats->holder;
+    GLUTnanoseconds start, locked;
+    int ok;
+
+    // Racy by design: a glance before locking costs nothing, and an
+    // occasional miss only undercounts.
+    if (holder != SLOT_SYNC_NO_HOLDER && holder != (unsigned int)sync->process) {
+        stats->contended[sync->process]++;
+        if (sync->process == SLOT_SYNC_MASTER) {
+            stats->inversions++;
+            TRACE_INSTANT(TRACE_INVERSION, slot);
+        }
+    }
+    start = glutGetNanoseconds();
+    TRACE_BEGIN(TRACE_LOCK);
+    ok = sync->backend->lock(sync->data, slot);
+    TRACE_END(TRACE_LOCK);
+    locked = glutGetNanoseconds();
+    recordFPShistogram(&stats->wait[sync->process], locked - start, sync->slow);
+    if (ok) {
+        stats->holder = sync->process;
+        sync->locked_at[slot] = locked;
+    }
+    return ok;
+}
+
+int unlockSlot(SlotSync *sync, int slot)
+{
+    SlotSyncStats *stats = &sync->stats[slot];
+    GLUTnanoseconds start, unlocked;
+    int ok;
+
+    start = glutGetNanoseconds();
+    recordFPShistogram(&stats->hold[sync->process], start - sync->locked_at[slot], sync->slow);
+    TRACE_BEGIN(TRACE_UNLOCK);
+    ok = sync->backend->unlock(sync->data, slot);
+    TRACE_END(TRACE_UNLOCK);
+    unlocked = glutGetNanoseconds();
+    recordFPShistogram(&stats->unlock[sync->process], unlocked - start, sync->slow);
+    if (ok) {
+        stats->holder = SLOT_SYNC_NO_HOLDER;
+    }
+    return ok;
+}
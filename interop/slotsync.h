@@ -0,0 +1,71 @@
+#ifndef SLOTSYNC_H
+#define SLOTSYNC_H
+
+/* slotsync.h - timed lock/unlock of shared render buffers */
+
+/* lockSlot and unlockSlot wrap a backend's lock and unlock of one
+   shared buffer (wglDXLockObjectsNV today).  Each process records how
+   long it waited for the lock, held it, and took to unlock (which may
+   flush) into per-slot histograms kept in memory both processes share,
+   along with how often it found the other process holding the slot.
+   The master finding the renderer holding a slot is a priority
+   inversion: the process that must hit every refresh waits on the one
+   that may take as long as it likes.
+
+   Include showfps.h (and so GL and GLUT) first. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    SLOT_SYNC_MASTER,
+    SLOT_SYNC_RENDERER,
+    SLOT_SYNC_PROCESSES
+} SlotSyncProcess;
+
+#define SLOT_SYNC_NO_HOLDER SLOT_SYNC_PROCESSES
+
+/* Lock and unlock return nonzero on success; on failure they report
+   the backend's error themselves. */
+typedef struct _SlotSyncBackend {
+    const char *name;
+    int (*lock)(void *data, int slot);
+    int (*unlock)(void *data, int slot);
+} SlotSyncBackend;
+
+/* One per slot, in shared memory; each process writes only its own
+   entries, except holder. */
+typedef struct _SlotSyncStats {
+    volatile unsigned int holder;         // SlotSyncProcess, or SLOT_SYNC_NO_HOLDER
+    unsigned int contended[SLOT_SYNC_PROCESSES];  // other process held the slot
+    unsigned int inversions;              // master found the renderer holding it
+    FPShistogram wait[SLOT_SYNC_PROCESSES];
+    FPShistogram hold[SLOT_SYNC_PROCESSES];
+    FPShistogram unlock[SLOT_SYNC_PROCESSES];
+} SlotSyncStats;
+
+#define MAX_SLOT_SYNC_SLOTS 4
+
+typedef struct _SlotSync {
+    const SlotSyncBackend *backend;
+    void *data;                           // passed to the backend
+    SlotSyncProcess process;
+    SlotSyncStats *stats;                 // array of slot_count
+    int slot_count;
+    GLUTnanoseconds slow;                 // waits and holds past this count as over budget
+    GLUTnanoseconds locked_at[MAX_SLOT_SYNC_SLOTS];  // this process only
+} SlotSync;
+
+/* stats may already be in use by the other process; pass reset
+   nonzero only from the process that creates them. */
+extern void initSlotSync(SlotSync *sync, const SlotSyncBackend *backend, void *data,
+                         SlotSyncProcess process, SlotSyncStats *stats, int slot_count, int reset);
+extern int lockSlot(SlotSync *sync, int slot);
+extern int unlockSlot(SlotSync *sync, int slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SLOTSYNC_H */
@@ -0,0 +1,140 @@
+
+/* trace.c - cross-process trace events exported as Chrome trace JSON */
+
+// Copyright (c) NVIDIA Corporation. All rights reserved.
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>  /* for QueryPerformanceCounter and InterlockedIncrement */
+#else
+#include <time.h>
+#endif
+
+#include "trace.h"
+
+TraceRing *trace_ring = NULL;
+
+static const char *event_name[TRACE_EVENT_COUNT] = {
+    "render",
+    "lock",
+    "draw",
+    "unlock",
+    "publish",
+    "fifo full",
+    "display",
+    "swap",
+    "skip",
+    "priority inversion",
+};
+
+// Both processes must agree on the time base, so this reads the
+// system-wide monotonic clock rather than time since glutInit.
+unsigned long long traceClock(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER count;
+
+    if (!freq.QuadPart) {
+        QueryPerformanceFrequency(&freq);
+    }
+    QueryPerformanceCounter(&count);
+    return (unsigned long long)(count.QuadPart / freq.QuadPart) * 1000000000 +
+           (unsigned long long)(count.QuadPart % freq.QuadPart) * 1000000000 / freq.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+static unsigned int claimSlot(TraceRing *ring)
+{
+#ifdef _WIN32
+    return (unsigned int)InterlockedIncrement((volatile LONG*)&ring->head) - 1;
+#else
+    return __sync_fetch_and_add(&ring->head, 1);
+#endif
+}
+
+void initTraceRing(TraceRing *ring, const char *name, unsigned int pid)
+{
+    strncpy(ring->name, name, sizeof(ring->name)-1);
+    ring->name[sizeof(ring->name)-1] = '\0';
+    ring->pid = pid;
+    ring->head = 0;
+}
+
+void traceEvent(TraceRing *ring, TraceEventId id, char phase, unsigned int arg)
+{
+    TraceEvent *e;
+
+    if (!ring) {
+        return;
+    }
+    e = &ring->event[claimSlot(ring) & (TRACE_RING_EVENTS-1)];
+    e->timestamp = traceClock();
+    e->id = (unsigned short)id;
+    e->phase = phase;
+    e->arg = arg;
+}
+
+// Oldest event still in the ring.
+static unsigned int firstEvent(unsigned int head)
+{
+    return head > TRACE_RING_EVENTS ? head - TRACE_RING_EVENTS : 0;
+}
+
+int writeChromeTrace(const char *filename, const TraceRing *const *rings, int count)
+{
+    unsigned long long origin = ~0ull;
+    const char *separator = "";
+    FILE *file;
+    int r;
+
+    file = fopen(filename, "w");
+    if (!file) {
+        return 0;
+    }
+    // Times are written relative to the earliest event kept by any ring.
+    for (r=0; r<count; r++) {
+        const unsigned int head = rings[r]->head;
+
+        if (head > 0) {
+            const TraceEvent *e = &rings[r]->event[firstEvent(head) & (TRACE_RING_EVENTS-1)];
+            if (e->timestamp < origin) {
+                origin = e->timestamp;
+            }
+        }
+    }
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (r=0; r<count; r++) {
+        const TraceRing *ring = rings[r];
+        // Snapshot the head; the other process may still be appending.
+        const unsigned int head = ring->head;
+        unsigned int i;
+
+        fprintf(file, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"%s\"}}",
+            separator, ring->pid, ring->name);
+        separator = ",\n";
+        for (i=firstEvent(head); i!=head; i++) {
+            const TraceEvent *e = &ring->event[i & (TRACE_RING_EVENTS-1)];
+
+            if (e->id >= TRACE_EVENT_COUNT || e->timestamp < origin) {
+                continue;  // overwritten while we read
+            }
+            fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%u,\"tid\":1",
+                separator, event_name[e->id], e->phase,
+                (e->timestamp - origin) / 1000.0, ring->pid);
+            if (e->phase == 'i') {
+                fprintf(file, ",\"s\":\"p\",\"args\":{\"value\":%u}", e->arg);
+            }
+            fputc('}', file);
+        }
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0;
+}
@@ -0,0 +1,81 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/* trace.h - cross-process trace events exported as Chrome trace JSON */
+
+/* Each process appends fixed-size events to its own TraceRing, which
+   lives in memory shared with the other process.  Appending is one
+   atomic increment plus a store; the ring wraps, keeping the most
+   recent TRACE_RING_EVENTS events.  writeChromeTrace merges rings into
+   a file that chrome://tracing and ui.perfetto.dev load.
+
+   Build with INTEROP_TRACE defined to 0 to compile every TRACE_* macro
+   out to nothing. */
+
+#ifndef INTEROP_TRACE
+#define INTEROP_TRACE 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_RING_EVENTS 16384  // must be a power of two
+
+/* Event ids rather than name pointers, since the rings are read by a
+   process whose copy of the strings may live at another address. */
+typedef enum {
+    TRACE_RENDER,      // renderer draws a frame for the master
+    TRACE_LOCK,        // wglDXLockObjectsNV
+    TRACE_DRAW,        // drawing while the shared texture is locked
+    TRACE_UNLOCK,      // wglDXUnlockObjectsNV
+    TRACE_PUBLISH,     // renderer makes a frame available
+    TRACE_FIFO_FULL,   // renderer found no free buffer
+    TRACE_DISPLAY,     // master draws a window frame
+    TRACE_SWAP,        // glutSwapBuffers
+    TRACE_SKIP,        // master drops a stale frame
+    TRACE_INVERSION,   // master waits on a slot the renderer holds
+    TRACE_EVENT_COUNT
+} TraceEventId;
+
+typedef struct _TraceEvent {
+    unsigned long long timestamp;  // nanoseconds, system-wide monotonic
+    unsigned short id;             // TraceEventId
+    char phase;                    // 'B'egin, 'E'nd, or 'i'nstant
+    char pad;
+    unsigned int arg;
+} TraceEvent;
+
+typedef struct _TraceRing {
+    char name[16];                 // process name shown in the trace
+    unsigned int pid;
+    volatile unsigned int head;    // events ever appended
+    TraceEvent event[TRACE_RING_EVENTS];
+} TraceRing;
+
+/* The ring this process appends to, or NULL to drop events. */
+extern TraceRing *trace_ring;
+
+/* Nanoseconds of the system-wide monotonic clock; comparable between
+   processes, unlike glutGetNanoseconds. */
+extern unsigned long long traceClock(void);
+extern void initTraceRing(TraceRing *ring, const char *name, unsigned int pid);
+extern void traceEvent(TraceRing *ring, TraceEventId id, char phase, unsigned int arg);
+/* Returns nonzero if the file was written. */
+extern int writeChromeTrace(const char *filename, const TraceRing *const *rings, int count);
+
+#if INTEROP_TRACE
+#define TRACE_BEGIN(id) traceEvent(trace_ring, id, 'B', 0)
+#define TRACE_END(id) traceEvent(trace_ring, id, 'E', 0)
+#define TRACE_INSTANT(id, arg) traceEvent(trace_ring, id, 'i', arg)
+#else
+#define TRACE_BEGIN(id) ((void)0)
+#define TRACE_END(id) ((void)0)
+#define TRACE_INSTANT(id, arg) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H */